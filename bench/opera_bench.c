@@ -0,0 +1,477 @@
+/*
+  opera-bench: headless batch runner
+
+  Runs a BIOS (and optionally a disc image) for a fixed number of
+  frames as fast as the host allows and reports throughput and host
+  time per subsystem. Intended as a performance regression gate so it
+  needs nothing but a filesystem.
+
+  usage: opera-bench -b bios [-f font] [-d disc] [-n frames]
+                     [-i input_script] [-H hash_file]
+                     [-r ntsc|pal1|pal2] [-x]
+
+  The input script is plain text, one joypad change per line:
+
+    <frame> <port> <buttons>
+
+  where buttons is a comma separated list of u,d,l,r,a,b,c,p,x,lt,rt
+  or '-' for none. A port keeps its buttons until changed. Lines
+  starting with '#' are ignored. Lines must be in frame order.
+
+  With -H the FNV-1a hash of every rendered frame is written as
+  "<frame> <hash>" per line.
+*/
+
+#include "libopera/opera_3do.h"
+#include "libopera/opera_arm.h"
+#include "libopera/opera_cdrom.h"
+#include "libopera/opera_core.h"
+#include "libopera/opera_dsp.h"
+#include "libopera/opera_pbus.h"
+#include "libopera/opera_perf.h"
+#include "libopera/opera_region.h"
+#include "libopera/opera_vdlp.h"
+
+#include "lr_cdrom.h"
+#include "nvram.h"
+#include "retro_callbacks.h"
+#include "retro_cdimage.h"
+
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_FRAMES 600
+#define BENCH_MAX_PORTS      8
+
+struct bench_input_s
+{
+  uint32_t            frame;
+  uint32_t            port;
+  opera_pbus_joypad_t pad;
+};
+
+typedef struct bench_input_s bench_input_t;
+
+struct bench_args_s
+{
+  const char *bios;
+  const char *font;
+  const char *disc;
+  const char *input;
+  const char *hashes;
+  const char *region;
+  uint32_t    frames;
+  int         hires;
+};
+
+typedef struct bench_args_s bench_args_t;
+
+static cdimage_t      CDIMAGE;
+static bench_input_t *INPUTS      = NULL;
+static uint32_t       INPUT_COUNT = 0;
+static uint32_t       PORT_COUNT  = 0;
+
+static
+uint64_t
+bench_clock_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+
+  return (((uint64_t)ts.tv_sec * 1000000000ULL) + ts.tv_nsec);
+}
+
+static
+void
+bench_log(enum retro_log_level level_,
+          const char          *fmt_,
+          ...)
+{
+  va_list args;
+
+  if(level_ < RETRO_LOG_WARN)
+    return;
+
+  va_start(args,fmt_);
+  vfprintf(stderr,fmt_,args);
+  va_end(args);
+}
+
+static
+void*
+bench_callback(int   cmd_,
+               void *data_)
+{
+  (void)data_;
+
+  switch(cmd_)
+    {
+    case EXT_DSP_TRIGGER:
+      opera_dsp_loop();
+      break;
+    default:
+      break;
+    }
+
+  return NULL;
+}
+
+static
+int
+load_rom(const char *path_,
+         uint8_t    *rom_,
+         uint64_t    size_)
+{
+  FILE *f;
+  size_t rv;
+
+  f = fopen(path_,"rb");
+  if(f == NULL)
+    return -1;
+
+  memset(rom_,0,size_);
+  rv = fread(rom_,1,size_,f);
+  fclose(f);
+
+  return ((rv > 0) ? 0 : -1);
+}
+
+static
+int
+parse_buttons(char                *str_,
+              opera_pbus_joypad_t *pad_)
+{
+  char *tok;
+  char *save;
+
+  memset(pad_,0,sizeof(*pad_));
+  if(!strcmp(str_,"-"))
+    return 0;
+
+  for(tok = strtok_r(str_,",",&save); tok; tok = strtok_r(NULL,",",&save))
+    {
+      if(!strcmp(tok,"u"))
+        pad_->u = 1;
+      else if(!strcmp(tok,"d"))
+        pad_->d = 1;
+      else if(!strcmp(tok,"l"))
+        pad_->l = 1;
+      else if(!strcmp(tok,"r"))
+        pad_->r = 1;
+      else if(!strcmp(tok,"a"))
+        pad_->a = 1;
+      else if(!strcmp(tok,"b"))
+        pad_->b = 1;
+      else if(!strcmp(tok,"c"))
+        pad_->c = 1;
+      else if(!strcmp(tok,"p"))
+        pad_->p = 1;
+      else if(!strcmp(tok,"x"))
+        pad_->x = 1;
+      else if(!strcmp(tok,"lt"))
+        pad_->lt = 1;
+      else if(!strcmp(tok,"rt"))
+        pad_->rt = 1;
+      else
+        return -1;
+    }
+
+  return 0;
+}
+
+static
+int
+load_input_script(const char *path_)
+{
+  FILE *f;
+  char line[256];
+  char buttons[128];
+  uint32_t lineno;
+  bench_input_t in;
+  bench_input_t *tmp;
+
+  f = fopen(path_,"r");
+  if(f == NULL)
+    return -1;
+
+  lineno = 0;
+  while(fgets(line,sizeof(line),f) != NULL)
+    {
+      lineno++;
+      if((line[0] == '#') || (line[0] == '\n') || (line[0] == '\r'))
+        continue;
+
+      if((sscanf(line,"%u %u %127s",&in.frame,&in.port,buttons) != 3) ||
+         (in.port >= BENCH_MAX_PORTS) ||
+         (parse_buttons(buttons,&in.pad) == -1) ||
+         (INPUT_COUNT && (in.frame < INPUTS[INPUT_COUNT - 1].frame)))
+        {
+          fprintf(stderr,"%s:%u: invalid input line\n",path_,lineno);
+          fclose(f);
+          return -1;
+        }
+
+      tmp = realloc(INPUTS,(INPUT_COUNT + 1) * sizeof(bench_input_t));
+      if(tmp == NULL)
+        break;
+
+      INPUTS = tmp;
+      INPUTS[INPUT_COUNT++] = in;
+      if(in.port >= PORT_COUNT)
+        PORT_COUNT = (in.port + 1);
+    }
+
+  fclose(f);
+
+  return 0;
+}
+
+static
+void
+input_update(const uint32_t       frame_,
+             uint32_t            *next_,
+             opera_pbus_joypad_t *pads_)
+{
+  uint32_t i;
+
+  while((*next_ < INPUT_COUNT) && (INPUTS[*next_].frame <= frame_))
+    {
+      pads_[INPUTS[*next_].port] = INPUTS[*next_].pad;
+      (*next_)++;
+    }
+
+  opera_pbus_reset();
+  for(i = 0; i < PORT_COUNT; i++)
+    opera_pbus_add_joypad(&pads_[i]);
+}
+
+static
+uint64_t
+fnv1a64(const void *data_,
+        size_t      size_)
+{
+  size_t i;
+  uint64_t h;
+  const uint8_t *p = data_;
+
+  h = 0xCBF29CE484222325ULL;
+  for(i = 0; i < size_; i++)
+    {
+      h ^= p[i];
+      h *= 0x100000001B3ULL;
+    }
+
+  return h;
+}
+
+static
+void
+usage(void)
+{
+  fprintf(stderr,
+          "usage: opera-bench -b bios [-f font] [-d disc] [-n frames]\n"
+          "                   [-i input_script] [-H hash_file]\n"
+          "                   [-r ntsc|pal1|pal2] [-x]\n");
+}
+
+static
+int
+parse_args(int           argc_,
+           char        **argv_,
+           bench_args_t *args_)
+{
+  int c;
+
+  memset(args_,0,sizeof(*args_));
+  args_->frames = BENCH_DEFAULT_FRAMES;
+
+  while((c = getopt(argc_,argv_,"b:f:d:n:i:H:r:x")) != -1)
+    {
+      switch(c)
+        {
+        case 'b': args_->bios   = optarg; break;
+        case 'f': args_->font   = optarg; break;
+        case 'd': args_->disc   = optarg; break;
+        case 'n': args_->frames = strtoul(optarg,NULL,0); break;
+        case 'i': args_->input  = optarg; break;
+        case 'H': args_->hashes = optarg; break;
+        case 'r': args_->region = optarg; break;
+        case 'x': args_->hires  = 1; break;
+        default:
+          return -1;
+        }
+    }
+
+  if(args_->bios == NULL)
+    return -1;
+
+  return 0;
+}
+
+static
+int
+set_region(const char *region_)
+{
+  if((region_ == NULL) || !strcmp(region_,"ntsc"))
+    opera_region_set_NTSC();
+  else if(!strcmp(region_,"pal1"))
+    opera_region_set_PAL1();
+  else if(!strcmp(region_,"pal2"))
+    opera_region_set_PAL2();
+  else
+    return -1;
+
+  return 0;
+}
+
+static
+void
+report(const bench_args_t *args_,
+       const uint64_t      ns_)
+{
+  int i;
+  double secs;
+  double fps;
+  double frame_ns;
+
+  secs     = (ns_ / 1e9);
+  fps      = (args_->frames / secs);
+  frame_ns = opera_perf_total_time();
+
+  printf("frames        %u\n",args_->frames);
+  printf("host_seconds  %.6f\n",secs);
+  printf("fps           %.2f\n",fps);
+  printf("speed         %.3f\n",fps / opera_region_field_rate());
+
+  for(i = 0; i < OPERA_PERF_TIMER_COUNT; i++)
+    printf("time_%-8s %.6f %.2f%%\n",
+           opera_perf_timer_name(i),
+           opera_perf_time(i) / 1e9,
+           ((frame_ns > 0) ? (opera_perf_time(i) * 100.0 / frame_ns) : 0.0));
+
+  for(i = 0; i < OPERA_PERF_COUNTER_COUNT; i++)
+    printf("count_%s %llu\n",
+           opera_perf_counter_name(i),
+           (unsigned long long)opera_perf_counter(i));
+}
+
+int
+main(int    argc_,
+     char **argv_)
+{
+  int rv;
+  uint32_t frame;
+  uint32_t next_input;
+  uint32_t width;
+  uint32_t height;
+  uint32_t *video;
+  uint64_t start;
+  uint64_t elapsed;
+  FILE *hashes;
+  bench_args_t args;
+  opera_pbus_joypad_t pads[BENCH_MAX_PORTS];
+
+  if(parse_args(argc_,argv_,&args) == -1)
+    {
+      usage();
+      return 1;
+    }
+
+  retro_set_log_printf_cb(bench_log);
+
+  if(args.disc && (retro_cdimage_open(args.disc,&CDIMAGE) == -1))
+    {
+      fprintf(stderr,"unable to open disc image: %s\n",args.disc);
+      return 1;
+    }
+
+  if(args.input && (load_input_script(args.input) == -1))
+    return 1;
+
+  hashes = NULL;
+  if(args.hashes && ((hashes = fopen(args.hashes,"w")) == NULL))
+    {
+      fprintf(stderr,"unable to open hash file: %s\n",args.hashes);
+      return 1;
+    }
+
+  lr_cdrom_init(&CDIMAGE);
+  opera_cdrom_set_callbacks(lr_cdrom_get_size,
+                            lr_cdrom_set_sector,
+                            lr_cdrom_read_sector);
+  if(opera_3do_init(bench_callback) == -1)
+    {
+      fprintf(stderr,"unable to allocate emulator memory\n");
+      return 1;
+    }
+
+  if(set_region(args.region) == -1)
+    {
+      usage();
+      return 1;
+    }
+
+  width  = opera_region_width();
+  height = opera_region_height();
+  if(args.hires)
+    {
+      HIRESMODE = 1;
+      width   <<= 1;
+      height  <<= 1;
+    }
+
+  video = calloc(opera_region_max_width() * opera_region_max_height() * 4,
+                 sizeof(uint32_t));
+  opera_vdlp_configure(video,
+                       VDLP_PIXEL_FORMAT_XRGB8888,
+                       (args.hires ? VDLP_FLAG_HIRES_CEL : VDLP_FLAG_NONE));
+
+  rv = load_rom(args.bios,opera_arm_rom1_get(),opera_arm_rom1_size());
+  if(rv == -1)
+    {
+      fprintf(stderr,"unable to load BIOS: %s\n",args.bios);
+      return 1;
+    }
+  opera_arm_rom1_byteswap_if_necessary();
+
+  if(args.font && (load_rom(args.font,opera_arm_rom2_get(),opera_arm_rom2_size()) == 0))
+    opera_arm_rom2_byteswap_if_necessary();
+
+  nvram_init(opera_arm_nvram_get());
+
+  opera_perf_set_clock(bench_clock_ns);
+  opera_perf_reset();
+
+  memset(pads,0,sizeof(pads));
+  next_input = 0;
+  start = bench_clock_ns();
+  for(frame = 0; frame < args.frames; frame++)
+    {
+      input_update(frame,&next_input,pads);
+      opera_3do_process_frame();
+
+      if(hashes)
+        fprintf(hashes,"%u %016llx\n",
+                frame,
+                (unsigned long long)fnv1a64(video,width * height * sizeof(uint32_t)));
+    }
+  elapsed = (bench_clock_ns() - start);
+
+  report(&args,elapsed);
+
+  if(hashes)
+    fclose(hashes);
+  opera_3do_destroy();
+  lr_cdrom_destroy();
+  retro_cdimage_close(&CDIMAGE);
+  free(video);
+  free(INPUTS);
+
+  return 0;
+}
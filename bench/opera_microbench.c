@@ -0,0 +1,1339 @@
+/*
+  opera-microbench: libopera kernel microbenchmarks
+
+  Times the hot kernels of libopera in isolation on synthetic inputs
+  built in place (ARM instruction mixes, CEL lists, VDL frames, DSP
+  programs) so neither a BIOS nor a disc image is needed. Each kernel
+  is run for at least the minimum time after calibrating an iteration
+  count and the result is printed as one tab separated line:
+
+    <name> <unit> <units> <seconds> <ns_per_unit> <units_per_second>
+
+  Lines starting with '#' describe the host so results from different
+  machines can be kept side by side.
+
+  usage: opera-microbench [-t min_seconds] [-f filter] [-c features] [-l]
+
+  -f runs only the kernels whose name contains the filter and -l
+  lists the kernel names without running them. -c limits the host
+  CPU features the dispatched kernels may use to a comma separated
+  list of sse2, sse41, avx2 and neon, "none" forces the scalar ones.
+*/
+
+#include "libopera/opera_3do.h"
+#include "libopera/opera_arm.h"
+#include "libopera/opera_bitop.h"
+#include "libopera/opera_cdrom.h"
+#include "libopera/opera_core.h"
+#include "libopera/opera_cpu.h"
+#include "libopera/opera_dsp.h"
+#include "libopera/opera_fixedpoint_math.h"
+#include "libopera/opera_madam.h"
+#include "libopera/opera_region.h"
+#include "libopera/opera_sport.h"
+#include "libopera/opera_vdlp.h"
+
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MB_DEFAULT_MIN_SECONDS 0.1
+
+/* where the synthetic inputs live in emulated DRAM */
+#define MB_DATA_ADDR  0x00100000
+#define MB_BITS_ADDR  0x00010000
+#define MB_CCB_ADDR   0x00040000
+#define MB_PLUT_ADDR  0x00041000
+#define MB_PDATA_ADDR 0x00050000
+#define MB_VRAM_ADDR  0x00200000
+
+/* CCB flags as decoded by opera_madam.c */
+#define MB_CCB_LAST   0x40000000
+#define MB_CCB_NPABS  0x20000000
+#define MB_CCB_SPABS  0x10000000
+#define MB_CCB_PPABS  0x08000000
+#define MB_CCB_LDSIZE 0x04000000
+#define MB_CCB_LDPRS  0x02000000
+#define MB_CCB_LDPPMP 0x01000000
+#define MB_CCB_LDPLUT 0x00800000
+#define MB_CCB_CCBPRE 0x00400000
+#define MB_CCB_YOXY   0x00200000
+#define MB_CCB_ACW    0x00040000
+#define MB_CCB_ACCW   0x00020000
+#define MB_CCB_USEAV  0x00000400
+#define MB_CCB_PACKED 0x00000200
+
+#define MB_PRE0_LINEAR 0x00000010
+#define MB_PRE1_LRFORM 0x00000800
+
+#define MB_CEL_W     32
+#define MB_CEL_H     32
+#define MB_CEL_COUNT 16
+
+#define MB_BITREADER_READS 4096
+#define MB_FIXED_COUNT     256
+
+enum mb_cel_format_e
+  {
+    MB_CEL_LITERAL,
+    MB_CEL_PACKED,
+    MB_CEL_LRFORM
+  };
+
+enum mb_cel_geometry_e
+  {
+    MB_CEL_UNSCALED,
+    MB_CEL_SCALED,
+    MB_CEL_ROTATED,
+    MB_CEL_PERSPECTIVE
+  };
+
+typedef void (*mb_setup_t)(const void *arg_);
+typedef uint64_t (*mb_run_t)(const void *arg_, uint64_t iters_);
+
+struct mb_kernel_s
+{
+  char        name[64];
+  const char *unit;
+  mb_setup_t  setup;
+  mb_run_t    run;
+  const void *arg;
+};
+
+typedef struct mb_kernel_s mb_kernel_t;
+
+struct mb_arm_mix_s
+{
+  const char     *name;
+  const uint32_t *body;
+  uint32_t        count;
+};
+
+typedef struct mb_arm_mix_s mb_arm_mix_t;
+
+struct mb_cel_s
+{
+  int         format;
+  int         bpp;
+  int         geometry;
+  uint32_t    pixc;
+  uint32_t    flags;
+};
+
+typedef struct mb_cel_s mb_cel_t;
+
+struct mb_vdlp_s
+{
+  vdlp_pixel_format_e format;
+  uint32_t            flags;
+};
+
+typedef struct mb_vdlp_s mb_vdlp_t;
+
+struct mb_dsp_s
+{
+  const char     *name;
+  const uint16_t *code;
+  uint32_t        count;
+};
+
+typedef struct mb_dsp_s mb_dsp_t;
+
+struct mb_bits_s
+{
+  uint32_t *words;
+  uint32_t  bit;
+};
+
+typedef struct mb_bits_s mb_bits_t;
+
+static volatile uint32_t SINK;
+static uint32_t          RNG = 0x12345678;
+static uint32_t         *VIDEO;
+static mb_kernel_t      *KERNELS;
+static uint32_t          KERNEL_COUNT;
+
+static
+uint64_t
+mb_clock_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+static
+uint32_t
+mb_rand(void)
+{
+  RNG ^= (RNG << 13);
+  RNG ^= (RNG >> 17);
+  RNG ^= (RNG << 5);
+
+  return RNG;
+}
+
+static
+void*
+mb_callback(int   cmd_,
+            void *data_)
+{
+  (void)cmd_;
+  (void)data_;
+
+  return NULL;
+}
+
+/* an empty drive */
+
+static
+uint32_t
+mb_cdrom_get_size(void)
+{
+  return 0;
+}
+
+static
+void
+mb_cdrom_set_sector(const uint32_t sector_)
+{
+  (void)sector_;
+}
+
+static
+void
+mb_cdrom_read_sector(void *buf_)
+{
+  (void)buf_;
+}
+
+/* ARM interpreter: one iteration is one opera_arm_execute() call */
+
+static const uint32_t ARM_MIX_ALU[] =
+  {
+    0xE0811002,                 /* add  r1,r1,r2      */
+    0xE0422001,                 /* sub  r2,r2,r1      */
+    0xE0244001,                 /* eor  r4,r4,r1      */
+    0xE1855181,                 /* orr  r5,r5,r1,lsl#3 */
+    0xE1A06374,                 /* mov  r6,r4,ror r3  */
+    0xE0067005,                 /* and  r7,r6,r5      */
+    0xE1570001,                 /* cmp  r7,r1         */
+    0xE2833001                  /* add  r3,r3,#1      */
+  };
+
+static const uint32_t ARM_MIX_MEM[] =
+  {
+    0xE5907004,                 /* ldr  r7,[r0,#4]    */
+    0xE5807008,                 /* str  r7,[r0,#8]    */
+    0xE5D08001,                 /* ldrb r8,[r0,#1]    */
+    0xE5C08003,                 /* strb r8,[r0,#3]    */
+    0xE590900C,                 /* ldr  r9,[r0,#12]   */
+    0xE5809010,                 /* str  r9,[r0,#16]   */
+    0xE5901014,                 /* ldr  r1,[r0,#20]   */
+    0xE5801018                  /* str  r1,[r0,#24]   */
+  };
+
+static const uint32_t ARM_MIX_MUL[] =
+  {
+    0xE00A0291,                 /* mul  r10,r1,r2     */
+    0xE02BB291,                 /* mla  r11,r1,r2,r11 */
+    0xE0811002,                 /* add  r1,r1,r2      */
+    0xE00A0192,                 /* mul  r10,r2,r1     */
+    0xE02BB192,                 /* mla  r11,r2,r1,r11 */
+    0xE2822001                  /* add  r2,r2,#1      */
+  };
+
+static const uint32_t ARM_MIX_BRANCH[] =
+  {
+    0xE2533001,                 /* subs r3,r3,#1      */
+    0x1A000000,                 /* bne  +1            */
+    0xE2811001,                 /* add  r1,r1,#1      */
+    0xEB000001,                 /* bl   +2            */
+    0xE3530000,                 /* cmp  r3,#0         */
+    0xEA000001,                 /* b    +2            */
+    0xE2822001,                 /* add  r2,r2,#1      */
+    0xE1A0F00E,                 /* mov  pc,lr         */
+  };
+
+static const uint32_t ARM_MIX_LDM_STM[] =
+  {
+    0xE890001E,                 /* ldmia r0,{r1-r4}   */
+    0xE880001E,                 /* stmia r0,{r1-r4}   */
+    0xE8901FFE,                 /* ldmia r0,{r1-r12}  */
+    0xE8801FFE                  /* stmia r0,{r1-r12}  */
+  };
+
+static const uint32_t ARM_MIX_MIXED[] =
+  {
+    0xE5907004,                 /* ldr  r7,[r0,#4]    */
+    0xE0811007,                 /* add  r1,r1,r7      */
+    0xE1A02141,                 /* mov  r2,r1,asr#2   */
+    0xE00A0291,                 /* mul  r10,r1,r2     */
+    0xE5802008,                 /* str  r2,[r0,#8]    */
+    0xE2533001,                 /* subs r3,r3,#1      */
+    0x03A03010,                 /* moveq r3,#16       */
+    0xE890001E,                 /* ldmia r0,{r1-r4}   */
+    0xE1510002,                 /* cmp  r1,r2         */
+    0xB0811002,                 /* addlt r1,r1,r2     */
+    0xE5C01003                  /* strb r1,[r0,#3]    */
+  };
+
+/*
+  Flag setting ALU ops whose flags are mostly replaced before anything
+  tests them, as compiled loops tend to do
+*/
+static const uint32_t ARM_MIX_FLAGS[] =
+  {
+    0xE0911002,                 /* adds r1,r1,r2      */
+    0xE0515003,                 /* subs r5,r1,r3      */
+    0xE0116002,                 /* ands r6,r1,r2      */
+    0xE0327003,                 /* eors r7,r2,r3      */
+    0xE0B12003,                 /* adcs r2,r1,r3      */
+    0xE1918003,                 /* orrs r8,r1,r3      */
+    0xE2719000,                 /* rsbs r9,r1,#0      */
+    0xE1B0A0A1,                 /* movs r10,r1,lsr#1  */
+    0xE1510002,                 /* cmp  r1,r2         */
+    0xC2833001                  /* addgt r3,r3,#1     */
+  };
+
+/* msr between the banked modes, no exceptions taken */
+static const uint32_t ARM_MIX_MODE_SWITCH[] =
+  {
+    0xE3A040D1,                 /* mov  r4,#0xD1      */
+    0xE129F004,                 /* msr  cpsr,r4 (fiq) */
+    0xE2888001,                 /* add  r8,r8,#1      */
+    0xE3A040D2,                 /* mov  r4,#0xD2      */
+    0xE129F004,                 /* msr  cpsr,r4 (irq) */
+    0xE28DD001,                 /* add  sp,sp,#1      */
+    0xE3A040D3,                 /* mov  r4,#0xD3      */
+    0xE129F004                  /* msr  cpsr,r4 (svc) */
+  };
+
+/*
+  FIQ storm: the line is held asserted and the handler returns at
+  once, so every instruction of the body is followed by an FIQ entry
+  and return. See mb_arm_fiq_setup().
+*/
+static const uint32_t ARM_MIX_FIQ[] =
+  {
+    0xE3A04013,                 /* mov  r4,#0x13      */
+    0xE129F004,                 /* msr  cpsr,r4       */
+    0xE2811001,                 /* add  r1,r1,#1      */
+    0xE2822001                  /* add  r2,r2,#1      */
+  };
+
+static const uint32_t ARM_FIQ_HANDLER[] =
+  {
+    0xE2888001,                 /* add  r8,r8,#1      */
+    0xE25EF004                  /* subs pc,lr,#4      */
+  };
+
+static const mb_arm_mix_t ARM_MIXES[] =
+  {
+    {"alu",         ARM_MIX_ALU,         sizeof(ARM_MIX_ALU)         / sizeof(uint32_t)},
+    {"mem",         ARM_MIX_MEM,         sizeof(ARM_MIX_MEM)         / sizeof(uint32_t)},
+    {"mul",         ARM_MIX_MUL,         sizeof(ARM_MIX_MUL)         / sizeof(uint32_t)},
+    {"branch",      ARM_MIX_BRANCH,      sizeof(ARM_MIX_BRANCH)      / sizeof(uint32_t)},
+    {"ldm_stm",     ARM_MIX_LDM_STM,     sizeof(ARM_MIX_LDM_STM)     / sizeof(uint32_t)},
+    {"mixed",       ARM_MIX_MIXED,       sizeof(ARM_MIX_MIXED)       / sizeof(uint32_t)},
+    {"flags",       ARM_MIX_FLAGS,       sizeof(ARM_MIX_FLAGS)       / sizeof(uint32_t)},
+    {"mode_switch", ARM_MIX_MODE_SWITCH, sizeof(ARM_MIX_MODE_SWITCH) / sizeof(uint32_t)}
+  };
+
+
+static const mb_arm_mix_t ARM_FIQ =
+  {"fiq", ARM_MIX_FIQ, sizeof(ARM_MIX_FIQ) / sizeof(uint32_t)};
+
+static const uint32_t ARM_PROLOGUE[] =
+  {
+    0xE3A00601,                 /* mov  r0,#0x100000  */
+    0xE3A01001,                 /* mov  r1,#1         */
+    0xE3A02003,                 /* mov  r2,#3         */
+    0xE3A03007                  /* mov  r3,#7         */
+  };
+
+static
+void
+mb_arm_setup(const void *arg_)
+{
+  uint32_t i;
+  uint32_t n;
+  uint32_t *rom;
+  const mb_arm_mix_t *mix = arg_;
+
+  rom = (uint32_t*)opera_arm_rom1_get();
+
+  n = 0;
+  for(i = 0; i < (sizeof(ARM_PROLOGUE) / sizeof(uint32_t)); i++)
+    rom[n++] = ARM_PROLOGUE[i];
+  for(i = 0; i < mix->count; i++)
+    rom[n++] = mix->body[i];
+
+  /* b back to the start of the body */
+  rom[n] = (0xEA000000 | (((4 - (n + 2)) & 0x00FFFFFF)));
+
+  opera_arm_reset();
+}
+
+/* FIQ vector at 0x1C in DRAM, line asserted after the reset drops it */
+static
+void
+mb_arm_fiq_setup(const void *arg_)
+{
+  uint32_t i;
+  uint32_t *ram;
+
+  mb_arm_setup(arg_);
+
+  ram = (uint32_t*)opera_arm_ram_get();
+  for(i = 0; i < (sizeof(ARM_FIQ_HANDLER) / sizeof(uint32_t)); i++)
+    ram[(0x1C >> 2) + i] = ARM_FIQ_HANDLER[i];
+
+  opera_arm_fiq_set(1);
+}
+
+static
+uint64_t
+mb_arm_run(const void *arg_,
+           uint64_t    iters_)
+{
+  uint64_t i;
+  int32_t cycles;
+
+  cycles = 0;
+  for(i = 0; i < iters_; i++)
+    cycles += opera_arm_execute();
+  SINK = cycles;
+
+  return iters_;
+}
+
+/* MADAM's big endian bit reader over DRAM */
+
+static
+void
+mb_bitreader_setup(const void *arg_)
+{
+  uint32_t i;
+
+  (void)arg_;
+
+  for(i = 0; i < 0x4000; i += 4)
+    opera_mem_write32(MB_BITS_ADDR + i,mb_rand());
+}
+
+static
+uint64_t
+mb_bitreader_run(const void *arg_,
+                 uint64_t    iters_)
+{
+  uint8_t bits;
+  uint32_t j;
+  uint32_t sum;
+  uint64_t i;
+  struct BitReaderBig br;
+
+  bits = (uint8_t)(uintptr_t)arg_;
+  sum  = 0;
+  for(i = 0; i < iters_; i++)
+    {
+      BitReaderBig_AttachBuffer(&br,MB_BITS_ADDR);
+      for(j = 0; j < MB_BITREADER_READS; j++)
+        sum += BitReaderBig_Read(&br,bits);
+    }
+  SINK = sum;
+
+  return (iters_ * MB_BITREADER_READS);
+}
+
+/* CEL engine */
+
+static
+void
+mb_bits_put(mb_bits_t      *b_,
+            const uint32_t  val_,
+            const uint32_t  bits_)
+{
+  uint32_t i;
+
+  for(i = 0; i < bits_; i++, b_->bit++)
+    if((val_ >> (bits_ - 1 - i)) & 1)
+      b_->words[b_->bit >> 5] |= (0x80000000 >> (b_->bit & 31));
+}
+
+static
+uint32_t
+mb_cel_bpp_code(const int bpp_)
+{
+  switch(bpp_)
+    {
+    case 1:  return 1;
+    case 2:  return 2;
+    case 4:  return 3;
+    case 6:  return 4;
+    case 8:  return 5;
+    default: return 6;
+    }
+}
+
+static
+uint32_t
+mb_cel_pixel(const int bpp_)
+{
+  uint32_t v;
+
+  /* zero is transparent so keep every pixel visible */
+  v = (mb_rand() & ((bpp_ == 16) ? 0x7FFF : ((1 << bpp_) - 1)));
+  if(v == 0)
+    v = 1;
+
+  return v;
+}
+
+static
+void
+mb_cel_write(uint32_t        addr_,
+             const uint32_t *words_,
+             const uint32_t  count_)
+{
+  uint32_t i;
+
+  for(i = 0; i < count_; i++, addr_ += 4)
+    opera_mem_write32(addr_,words_[i]);
+}
+
+/* returns the size in words of a packed row written at words_ */
+static
+uint32_t
+mb_cel_packed_row(uint32_t  *words_,
+                  const int  bpp_)
+{
+  uint32_t x;
+  uint32_t n;
+  uint32_t i;
+  uint32_t type;
+  uint32_t size;
+  uint32_t offbits;
+  mb_bits_t b;
+
+  b.words = words_;
+  b.bit   = 0;
+  offbits = ((bpp_ < 8) ? 8 : 16);
+
+  mb_bits_put(&b,0,offbits);
+  for(x = 0, type = 0; x < MB_CEL_W; x += n, type = ((type + 1) % 3))
+    {
+      n = ((type == 2) ? 2 : 7);
+      if(n > (MB_CEL_W - x))
+        n = (MB_CEL_W - x);
+
+      switch(type)
+        {
+        case 0:                 /* literal */
+          mb_bits_put(&b,1,2);
+          mb_bits_put(&b,n - 1,6);
+          for(i = 0; i < n; i++)
+            mb_bits_put(&b,mb_cel_pixel(bpp_),bpp_);
+          break;
+        case 1:                 /* repeat */
+          mb_bits_put(&b,3,2);
+          mb_bits_put(&b,n - 1,6);
+          mb_bits_put(&b,mb_cel_pixel(bpp_),bpp_);
+          break;
+        case 2:                 /* transparent */
+          mb_bits_put(&b,2,2);
+          mb_bits_put(&b,n - 1,6);
+          break;
+        }
+    }
+  mb_bits_put(&b,0,8);          /* end of line */
+
+  size = ((b.bit + 31) >> 5);
+  if(size < 2)
+    size = 2;
+  words_[0] |= ((size - 2) << (32 - offbits));
+
+  return size;
+}
+
+static
+uint32_t
+mb_cel_pixels(const mb_cel_t *cel_,
+              uint32_t       *pre0_,
+              uint32_t       *pre1_)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t n;
+  uint32_t size;
+  uint32_t row;
+  uint32_t *words;
+  mb_bits_t b;
+
+  words = calloc(MB_CEL_W * MB_CEL_H,sizeof(uint32_t));
+
+  *pre0_ = mb_cel_bpp_code(cel_->bpp);
+  *pre1_ = 0;
+  if(!(cel_->flags & MB_CCB_LDPLUT) && (cel_->bpp >= 8))
+    *pre0_ |= MB_PRE0_LINEAR;
+
+  n = 0;
+  switch(cel_->format)
+    {
+    case MB_CEL_PACKED:
+      *pre0_ |= ((MB_CEL_H - 1) << 6);
+      for(i = 0; i < MB_CEL_H; i++)
+        n += mb_cel_packed_row(&words[n],cel_->bpp);
+      break;
+
+    case MB_CEL_LITERAL:
+      row     = (((MB_CEL_W * cel_->bpp) + 31) >> 5);
+      if(row < 2)
+        row = 2;
+      *pre0_ |= ((MB_CEL_H - 1) << 6);
+      *pre1_  = ((MB_CEL_W - 1) |
+                 ((cel_->bpp < 8) ? ((row - 2) << 24) : ((row - 2) << 16)));
+      for(i = 0; i < MB_CEL_H; i++, n += row)
+        {
+          b.words = &words[n];
+          b.bit   = 0;
+          for(j = 0; j < MB_CEL_W; j++)
+            mb_bits_put(&b,mb_cel_pixel(cel_->bpp),cel_->bpp);
+        }
+      break;
+
+    case MB_CEL_LRFORM:
+      /* two source rows share each word, top row in the high half */
+      *pre0_ |= (((MB_CEL_H / 2) - 1) << 6);
+      *pre1_  = ((MB_CEL_W - 1) | ((MB_CEL_W - 2) << 16) | MB_PRE1_LRFORM);
+      for(i = 0; i < (MB_CEL_H / 2); i++)
+        for(j = 0; j < MB_CEL_W; j++)
+          words[n++] = ((mb_cel_pixel(16) << 16) | mb_cel_pixel(16));
+      break;
+    }
+
+  size = n;
+  mb_cel_write(MB_PDATA_ADDR,words,size);
+  free(words);
+
+  return size;
+}
+
+static
+void
+mb_cel_setup(const void *arg_)
+{
+  uint32_t i;
+  uint32_t pre0;
+  uint32_t pre1;
+  uint32_t addr;
+  uint32_t plut[16];
+  uint32_t ccb[16];
+  int32_t hdx, hdy, vdx, vdy, hddx;
+  const mb_cel_t *cel = arg_;
+
+  /* 320x240 16bpp frame buffer in VRAM */
+  opera_madam_poke(0x130,0x1414);
+  opera_madam_poke(0x134,((239 << 16) | 319));
+  opera_madam_poke(0x138,MB_VRAM_ADDR);
+  opera_madam_poke(0x13C,MB_VRAM_ADDR);
+
+  for(i = 0; i < 16; i++)
+    plut[i] = ((mb_cel_pixel(16) << 16) | mb_cel_pixel(16));
+  mb_cel_write(MB_PLUT_ADDR,plut,16);
+
+  mb_cel_pixels(cel,&pre0,&pre1);
+
+  hddx = 0;
+  switch(cel->geometry)
+    {
+    default:
+    case MB_CEL_UNSCALED:
+      hdx = (1 << 20); hdy = 0; vdx = 0; vdy = (1 << 16);
+      break;
+    case MB_CEL_SCALED:
+      hdx = (3 << 19); hdy = 0; vdx = 0; vdy = (3 << 15);
+      break;
+    case MB_CEL_ROTATED:
+      /* 30 degrees */
+      hdx = (int32_t)(0.866025 * (1 << 20));
+      hdy = (1 << 19);
+      vdx = -(1 << 15);
+      vdy = (int32_t)(0.866025 * (1 << 16));
+      break;
+    case MB_CEL_PERSPECTIVE:
+      /* shrinks to half width over the height of the cel */
+      hdx = (1 << 20); hdy = 0; vdx = 0; vdy = (1 << 16);
+      hddx = -((1 << 20) / (2 * MB_CEL_H));
+      break;
+    }
+
+  for(i = 0; i < MB_CEL_COUNT; i++)
+    {
+      uint32_t n;
+
+      addr = (MB_CCB_ADDR + (i * sizeof(ccb)));
+
+      n = 0;
+      ccb[n++] = (MB_CCB_NPABS | MB_CCB_SPABS | MB_CCB_PPABS |
+                  MB_CCB_LDSIZE | MB_CCB_LDPRS | MB_CCB_LDPPMP |
+                  MB_CCB_CCBPRE | MB_CCB_YOXY |
+                  MB_CCB_ACW | MB_CCB_ACCW |
+                  cel->flags |
+                  ((i == (MB_CEL_COUNT - 1)) ? MB_CCB_LAST : 0));
+      ccb[n++] = ((i == (MB_CEL_COUNT - 1)) ? 0 : (addr + sizeof(ccb)));
+      ccb[n++] = MB_PDATA_ADDR;
+      ccb[n++] = MB_PLUT_ADDR;
+      ccb[n++] = ((8 + ((i % 4) * 76)) << 16);
+      ccb[n++] = ((8 + ((i / 4) * 58)) << 16);
+      ccb[n++] = hdx;
+      ccb[n++] = hdy;
+      ccb[n++] = vdx;
+      ccb[n++] = vdy;
+      ccb[n++] = hddx;
+      ccb[n++] = 0;
+      ccb[n++] = (cel->pixc | (cel->pixc << 16));
+      ccb[n++] = pre0;
+      if(!(cel->flags & MB_CCB_PACKED))
+        ccb[n++] = pre1;
+
+      mb_cel_write(addr,ccb,n);
+    }
+}
+
+static
+uint64_t
+mb_cel_run(const void *arg_,
+           uint64_t    iters_)
+{
+  uint64_t i;
+  uint32_t ccbs;
+
+  (void)arg_;
+
+  ccbs = 0;
+  for(i = 0; i < iters_; i++)
+    {
+      opera_madam_poke(0x5A4,MB_CCB_ADDR);
+      ccbs += opera_madam_cel_handle();
+    }
+  SINK = ccbs;
+
+  return (iters_ * MB_CEL_COUNT * MB_CEL_W * MB_CEL_H);
+}
+
+/* VDLP: one iteration renders a whole field from the startup VDL */
+
+static
+void
+mb_vdlp_setup(const void *arg_)
+{
+  uint32_t i;
+  const mb_vdlp_t *vdlp = arg_;
+
+  for(i = 0; i < (1024 * 1024); i += 4)
+    opera_mem_write32(MB_VRAM_ADDR + i,mb_rand());
+
+  opera_vdlp_init(opera_arm_vram_get());
+  opera_vdlp_configure(VIDEO,vdlp->format,vdlp->flags);
+}
+
+static
+uint64_t
+mb_vdlp_run(const void *arg_,
+            uint64_t    iters_)
+{
+  int line;
+  int lines;
+  uint64_t i;
+
+  (void)arg_;
+
+  lines = opera_region_scanlines();
+  for(i = 0; i < iters_; i++)
+    for(line = 0; line < lines; line++)
+      opera_vdlp_process_line(line);
+  SINK = VIDEO[0];
+
+  return (iters_ * lines);
+}
+
+/* DSP: canned programs, one iteration is one opera_dsp_loop() call */
+
+static const uint16_t DSP_PROG_SLEEP[] =
+  {
+    0x8380                      /* sleep */
+  };
+
+/* 8 channel mixer: sum of input[k] * gain[k] to both DACs */
+static const uint16_t DSP_PROG_MIXER[] =
+  {
+    0x5C00, 0x8000, 0x8010,     /* y  = in0 * gain0 */
+    0x5C20, 0x8001, 0x8011,     /* y += in1 * gain1 */
+    0x5C20, 0x8002, 0x8012,
+    0x5C20, 0x8003, 0x8013,
+    0x5C20, 0x8004, 0x8014,
+    0x5C20, 0x8005, 0x8015,
+    0x5C20, 0x8006, 0x8016,
+    0x5C20, 0x8007, 0x8017,
+    0x2000, 0x8BFE,             /* left  = y */
+    0x2000, 0x8BFF,             /* right = y */
+    0x8380                      /* sleep */
+  };
+
+/* counted loop: 64 decrements then sleep */
+static const uint16_t DSP_PROG_LOOP[] =
+  {
+    0x9920, 0xC040,             /* r[0x120] = 64 */
+    0x4640, 0x8920, 0xC001,     /* r[0x120] -= 1 */
+    0xD402,                     /* bne 2 */
+    0x8380                      /* sleep */
+  };
+
+static const mb_dsp_t DSP_PROGS[] =
+  {
+    {"sleep", DSP_PROG_SLEEP, sizeof(DSP_PROG_SLEEP) / sizeof(uint16_t)},
+    {"mixer", DSP_PROG_MIXER, sizeof(DSP_PROG_MIXER) / sizeof(uint16_t)},
+    {"loop",  DSP_PROG_LOOP,  sizeof(DSP_PROG_LOOP)  / sizeof(uint16_t)}
+  };
+
+static
+void
+mb_dsp_setup(const void *arg_)
+{
+  uint16_t i;
+  const mb_dsp_t *prog = arg_;
+
+  opera_dsp_reset();
+  for(i = 0; i < prog->count; i++)
+    opera_dsp_mem_write(i,prog->code[i]);
+  for(i = 0; i < 0x20; i++)
+    opera_dsp_imem_write(i,(uint16_t)mb_rand());
+  opera_dsp_set_running(1);
+}
+
+static
+uint64_t
+mb_dsp_run(const void *arg_,
+           uint64_t    iters_)
+{
+  uint64_t i;
+  uint32_t sum;
+
+  (void)arg_;
+
+  sum = 0;
+  for(i = 0; i < iters_; i++)
+    sum += opera_dsp_loop();
+  SINK = sum;
+
+  return iters_;
+}
+
+/* fixed point folio */
+
+static vec3f16  FIXED_V3[MB_FIXED_COUNT];
+static vec3f16  FIXED_V3_OUT[MB_FIXED_COUNT];
+static vec4f16  FIXED_V4[MB_FIXED_COUNT];
+static vec4f16  FIXED_V4_OUT[MB_FIXED_COUNT];
+static mat33f16 FIXED_M33;
+static mat44f16 FIXED_M44;
+static mat44f16 FIXED_M44_OUT;
+
+static
+void
+mb_fixed_setup(const void *arg_)
+{
+  uint32_t i;
+  uint32_t j;
+
+  (void)arg_;
+
+  for(i = 0; i < MB_FIXED_COUNT; i++)
+    {
+      for(j = 0; j < 3; j++)
+        FIXED_V3[i][j] = ((mb_rand() & 0x3FFFF) + 0x10000);
+      for(j = 0; j < 4; j++)
+        FIXED_V4[i][j] = ((mb_rand() & 0x3FFFF) + 0x10000);
+    }
+
+  for(i = 0; i < 3; i++)
+    for(j = 0; j < 3; j++)
+      FIXED_M33[i][j] = ((mb_rand() & 0x1FFFF) - 0x10000);
+  for(i = 0; i < 4; i++)
+    for(j = 0; j < 4; j++)
+      FIXED_M44[i][j] = ((mb_rand() & 0x1FFFF) - 0x10000);
+}
+
+static
+uint64_t
+mb_fixed_run(const void *arg_,
+             uint64_t    iters_)
+{
+  uint64_t i;
+  uint32_t j;
+  frac16 sum;
+  const char *fn = arg_;
+
+  sum = 0;
+  if(!strcmp(fn,"MulVec3Mat33_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        for(j = 0; j < MB_FIXED_COUNT; j++)
+          MulVec3Mat33_F16(FIXED_V3_OUT[j],FIXED_V3[j],FIXED_M33);
+    }
+  else if(!strcmp(fn,"MulMat44Mat44_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        for(j = 0; j < MB_FIXED_COUNT; j++)
+          MulMat44Mat44_F16(FIXED_M44_OUT,FIXED_M44,FIXED_M44);
+    }
+  else if(!strcmp(fn,"MulManyVec4Mat44_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        MulManyVec4Mat44_F16(FIXED_V4_OUT,FIXED_V4,FIXED_M44,MB_FIXED_COUNT);
+    }
+  else if(!strcmp(fn,"MulManyVec3Mat33DivZ_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        MulManyVec3Mat33DivZ_F16(FIXED_V3_OUT,FIXED_V3,&FIXED_M33,0x10000,MB_FIXED_COUNT);
+    }
+  else if(!strcmp(fn,"Dot3_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        for(j = 0; j < MB_FIXED_COUNT; j++)
+          sum += Dot3_F16(FIXED_V3[j],FIXED_V3[(j + 1) % MB_FIXED_COUNT]);
+    }
+  else if(!strcmp(fn,"Cross3_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        for(j = 0; j < MB_FIXED_COUNT; j++)
+          Cross3_F16(FIXED_V3_OUT[j],FIXED_V3[j],FIXED_V3[(j + 1) % MB_FIXED_COUNT]);
+    }
+  else if(!strcmp(fn,"AbsVec3_F16"))
+    {
+      for(i = 0; i < iters_; i++)
+        for(j = 0; j < MB_FIXED_COUNT; j++)
+          sum += AbsVec3_F16(FIXED_V3[j]);
+    }
+
+  SINK = (sum + FIXED_V3_OUT[0][0] + FIXED_V4_OUT[0][0] + FIXED_M44_OUT[0][0]);
+
+  return (iters_ * MB_FIXED_COUNT);
+}
+
+static const char *FIXED_FUNCS[] =
+  {
+    "MulVec3Mat33_F16",
+    "MulMat44Mat44_F16",
+    "MulManyVec4Mat44_F16",
+    "MulManyVec3Mat33DivZ_F16",
+    "Dot3_F16",
+    "Cross3_F16",
+    "AbsVec3_F16"
+  };
+
+/* emulated memory writes, which also pay for dirty page tracking */
+
+static
+uint64_t
+mb_mem_run(const void *arg_,
+           uint64_t    iters_)
+{
+  uint64_t i;
+  uint32_t addr;
+
+  (void)arg_;
+
+  for(i = 0; i < iters_; i++)
+    for(addr = 0; addr < 0x10000; addr += 4)
+      opera_mem_write32(MB_DATA_ADDR + addr,addr);
+
+  return (iters_ * (0x10000 / 4));
+}
+
+/*
+  SPORT page operations as the ARM issues them, one 2KiB VRAM page
+  each: flash fill, masked fill, copy and masked copy
+*/
+
+#define MB_SPORT_FLASH 0x00004000
+#define MB_SPORT_COLOR 0x00002000
+#define MB_SPORT_PAGES 64
+
+struct mb_sport_s
+{
+  uint32_t op;
+  uint32_t mask;
+};
+
+typedef struct mb_sport_s mb_sport_t;
+
+static const mb_sport_t SPORT_FILL      = {MB_SPORT_FLASH,0xFFFFFFFF};
+static const mb_sport_t SPORT_FILL_MASK = {MB_SPORT_FLASH,0x7BDE7BDE};
+static const mb_sport_t SPORT_COPY      = {0,0xFFFFFFFF};
+static const mb_sport_t SPORT_COPY_MASK = {0,0x7BDE7BDE};
+
+static
+void
+mb_sport_setup(const void *arg_)
+{
+  (void)arg_;
+
+  opera_sport_write_access(MB_SPORT_COLOR,0x12345678);
+  opera_sport_set_source(0);
+}
+
+static
+uint64_t
+mb_sport_run(const void *arg_,
+             uint64_t    iters_)
+{
+  uint64_t i;
+  uint32_t page;
+  const mb_sport_t *sport = arg_;
+
+  for(i = 0; i < iters_; i++)
+    for(page = 1; page <= MB_SPORT_PAGES; page++)
+      opera_sport_write_access(sport->op | page,sport->mask);
+
+  return (iters_ * MB_SPORT_PAGES * 512);
+}
+
+/* kernel table */
+
+static
+void
+mb_add(const char *name_,
+       const char *unit_,
+       mb_setup_t  setup_,
+       mb_run_t    run_,
+       const void *arg_)
+{
+  mb_kernel_t *k;
+
+  k = realloc(KERNELS,(KERNEL_COUNT + 1) * sizeof(mb_kernel_t));
+  if(k == NULL)
+    abort();
+  KERNELS = k;
+
+  k = &KERNELS[KERNEL_COUNT++];
+  snprintf(k->name,sizeof(k->name),"%s",name_);
+  k->unit  = unit_;
+  k->setup = setup_;
+  k->run   = run_;
+  k->arg   = arg_;
+}
+
+static const int         CEL_BPPS[]       = {1,2,4,6,8,16};
+static const char       *CEL_FORMATS[]    = {"literal","packed","lrform"};
+static const char       *CEL_GEOMETRIES[] = {"unscaled","scaled","rotated","perspective"};
+
+/* PIXC halves: s1 ms mxf dv1 | s2 av dv2 */
+static const struct { const char *name; uint32_t pixc; uint32_t flags; } CEL_PIXCS[] =
+  {
+    {"opaque",       0x1F00, 0},
+    {"translucent",  0x1F81, 0},
+    {"additive",     0x1F80, 0},
+    {"subtractive",  0x1F82, MB_CCB_USEAV},
+    {"shaded",       0x3F00, 0},
+    {"frame_source", 0x9F00, 0}
+  };
+
+static mb_cel_t  CELS[3 * 6 * 4 + 3 * 6];
+static mb_vdlp_t VDLPS[3 * 3];
+
+static
+void
+mb_build(void)
+{
+  int f;
+  int b;
+  int g;
+  int p;
+  uint32_t i;
+  uint32_t n;
+  char name[64];
+  static const char *pf_names[] = {"0rgb1555","xrgb8888","rgb565"};
+  static const char *flag_names[] = {"","/clut_bypass","/hires"};
+  static const uint32_t flag_values[] = {VDLP_FLAG_NONE,VDLP_FLAG_CLUT_BYPASS,VDLP_FLAG_HIRES_CEL};
+
+  for(i = 0; i < (sizeof(ARM_MIXES) / sizeof(ARM_MIXES[0])); i++)
+    {
+      snprintf(name,sizeof(name),"arm/%s",ARM_MIXES[i].name);
+      mb_add(name,"insns",mb_arm_setup,mb_arm_run,&ARM_MIXES[i]);
+    }
+  mb_add("arm/fiq","insns",mb_arm_fiq_setup,mb_arm_run,&ARM_FIQ);
+
+  for(i = 0; i < (sizeof(CEL_BPPS) / sizeof(CEL_BPPS[0])); i++)
+    {
+      snprintf(name,sizeof(name),"bitreader/%dbpp",CEL_BPPS[i]);
+      mb_add(name,"reads",mb_bitreader_setup,mb_bitreader_run,(void*)(uintptr_t)CEL_BPPS[i]);
+    }
+
+  /* every format, depth and geometry with opaque pixels */
+  n = 0;
+  for(f = MB_CEL_LITERAL; f <= MB_CEL_LRFORM; f++)
+    for(b = 0; b < 6; b++)
+      for(g = MB_CEL_UNSCALED; g <= MB_CEL_PERSPECTIVE; g++)
+        {
+          mb_cel_t *cel = &CELS[n++];
+
+          if((f == MB_CEL_LRFORM) && (CEL_BPPS[b] != 16))
+            continue;
+
+          cel->format   = f;
+          cel->bpp      = CEL_BPPS[b];
+          cel->geometry = g;
+          cel->pixc     = CEL_PIXCS[0].pixc;
+          cel->flags    = (((f == MB_CEL_PACKED) ? MB_CCB_PACKED : 0) |
+                           ((cel->bpp <= 6) ? MB_CCB_LDPLUT : 0));
+
+          snprintf(name,sizeof(name),"cel/%s/%dbpp/%s/%s",
+                   CEL_FORMATS[f],cel->bpp,CEL_GEOMETRIES[g],CEL_PIXCS[0].name);
+          mb_add(name,"pixels",mb_cel_setup,mb_cel_run,cel);
+        }
+
+  /* every pixel processor mode at 16bpp */
+  for(f = MB_CEL_LITERAL; f <= MB_CEL_LRFORM; f++)
+    for(p = 1; p < (int)(sizeof(CEL_PIXCS) / sizeof(CEL_PIXCS[0])); p++)
+      {
+        mb_cel_t *cel = &CELS[n++];
+
+        cel->format   = f;
+        cel->bpp      = 16;
+        cel->geometry = MB_CEL_UNSCALED;
+        cel->pixc     = CEL_PIXCS[p].pixc;
+        cel->flags    = (((f == MB_CEL_PACKED) ? MB_CCB_PACKED : 0) |
+                         CEL_PIXCS[p].flags);
+
+        snprintf(name,sizeof(name),"cel/%s/16bpp/unscaled/%s",
+                 CEL_FORMATS[f],CEL_PIXCS[p].name);
+        mb_add(name,"pixels",mb_cel_setup,mb_cel_run,cel);
+      }
+
+  n = 0;
+  for(f = 0; f < 3; f++)
+    for(i = 0; i < 3; i++)
+      {
+        mb_vdlp_t *vdlp = &VDLPS[n++];
+
+        vdlp->format = (vdlp_pixel_format_e)f;
+        vdlp->flags  = flag_values[i];
+
+        snprintf(name,sizeof(name),"vdlp/%s%s",pf_names[f],flag_names[i]);
+        mb_add(name,"lines",mb_vdlp_setup,mb_vdlp_run,vdlp);
+      }
+
+  for(i = 0; i < (sizeof(DSP_PROGS) / sizeof(DSP_PROGS[0])); i++)
+    {
+      snprintf(name,sizeof(name),"dsp/%s",DSP_PROGS[i].name);
+      mb_add(name,"samples",mb_dsp_setup,mb_dsp_run,&DSP_PROGS[i]);
+    }
+
+  for(i = 0; i < (sizeof(FIXED_FUNCS) / sizeof(FIXED_FUNCS[0])); i++)
+    {
+      snprintf(name,sizeof(name),"fixed/%s",FIXED_FUNCS[i]);
+      mb_add(name,"calls",mb_fixed_setup,mb_fixed_run,FIXED_FUNCS[i]);
+    }
+
+  mb_add("sport/fill","words",mb_sport_setup,mb_sport_run,&SPORT_FILL);
+  mb_add("sport/fill_mask","words",mb_sport_setup,mb_sport_run,&SPORT_FILL_MASK);
+  mb_add("sport/copy","words",mb_sport_setup,mb_sport_run,&SPORT_COPY);
+  mb_add("sport/copy_mask","words",mb_sport_setup,mb_sport_run,&SPORT_COPY_MASK);
+
+  mb_add("mem/write32","writes",NULL,mb_mem_run,NULL);
+}
+
+static
+void
+mb_measure(const mb_kernel_t *k_,
+           const double       min_seconds_)
+{
+  uint64_t iters;
+  uint64_t units;
+  uint64_t start;
+  uint64_t elapsed;
+  double secs;
+
+  if(k_->setup)
+    k_->setup(k_->arg);
+
+  /* warm up then double until the run is long enough to trust */
+  k_->run(k_->arg,1);
+  for(iters = 1;; iters *= 2)
+    {
+      start   = mb_clock_ns();
+      units   = k_->run(k_->arg,iters);
+      elapsed = (mb_clock_ns() - start);
+      if(elapsed >= (uint64_t)(min_seconds_ * 1e9))
+        break;
+    }
+
+  secs = (elapsed / 1e9);
+  printf("%s\t%s\t%llu\t%.6f\t%.3f\t%.0f\n",
+         k_->name,
+         k_->unit,
+         (unsigned long long)units,
+         secs,
+         ((double)elapsed / units),
+         (units / secs));
+  fflush(stdout);
+}
+
+static const struct { const char *name; uint32_t bit; } CPU_FEATURES[] =
+  {
+    {"sse2",  OPERA_CPU_SSE2},
+    {"sse41", OPERA_CPU_SSE41},
+    {"avx2",  OPERA_CPU_AVX2},
+    {"neon",  OPERA_CPU_NEON}
+  };
+
+/* -1 on an unknown name */
+static
+int64_t
+mb_parse_features(const char *str_)
+{
+  uint32_t i;
+  size_t len;
+  int64_t mask;
+
+  mask = 0;
+  while(*str_)
+    {
+      len = strcspn(str_,",");
+      for(i = 0; i < (sizeof(CPU_FEATURES) / sizeof(CPU_FEATURES[0])); i++)
+        if((strlen(CPU_FEATURES[i].name) == len) && !strncmp(str_,CPU_FEATURES[i].name,len))
+          break;
+      if(i < (sizeof(CPU_FEATURES) / sizeof(CPU_FEATURES[0])))
+        mask |= CPU_FEATURES[i].bit;
+      else if((len != 4) || strncmp(str_,"none",4))
+        return -1;
+
+      str_ += len;
+      if(*str_ == ',')
+        str_++;
+    }
+
+  return mask;
+}
+
+static
+void
+mb_print_host(void)
+{
+  FILE *f;
+  uint32_t i;
+  char line[256];
+
+  f = fopen("/proc/cpuinfo","r");
+  if(f != NULL)
+    {
+      while(fgets(line,sizeof(line),f) != NULL)
+        {
+          if(strncmp(line,"model name",10))
+            continue;
+          line[strcspn(line,"\n")] = '\0';
+          printf("# cpu      %s\n",strchr(line,':') ? (strchr(line,':') + 2) : line);
+          break;
+        }
+      fclose(f);
+    }
+
+#ifdef __VERSION__
+  printf("# compiler %s\n",__VERSION__);
+#endif
+  printf("# simd    ");
+  for(i = 0; i < (sizeof(CPU_FEATURES) / sizeof(CPU_FEATURES[0])); i++)
+    if(opera_cpu_features() & CPU_FEATURES[i].bit)
+      printf(" %s",CPU_FEATURES[i].name);
+  printf("\n");
+  printf("# name\tunit\tunits\tseconds\tns_per_unit\tunits_per_second\n");
+}
+
+static
+void
+usage(void)
+{
+  fprintf(stderr,
+          "usage: opera-microbench [-t min_seconds] [-f filter] [-c features] [-l]\n");
+}
+
+int
+main(int    argc_,
+     char **argv_)
+{
+  int opt;
+  int list;
+  uint32_t i;
+  int64_t features;
+  double min_seconds;
+  const char *filter;
+
+  list        = 0;
+  filter      = NULL;
+  features    = OPERA_CPU_ALL;
+  min_seconds = MB_DEFAULT_MIN_SECONDS;
+  while((opt = getopt(argc_,argv_,"t:f:c:lh")) != -1)
+    {
+      switch(opt)
+        {
+        case 't': min_seconds = strtod(optarg,NULL); break;
+        case 'f': filter      = optarg; break;
+        case 'c': features    = mb_parse_features(optarg); break;
+        case 'l': list        = 1; break;
+        default:
+          usage();
+          return 1;
+        }
+    }
+
+  if(features < 0)
+    {
+      usage();
+      return 1;
+    }
+
+  mb_build();
+
+  if(list)
+    {
+      for(i = 0; i < KERNEL_COUNT; i++)
+        printf("%s\n",KERNELS[i].name);
+      free(KERNELS);
+      return 0;
+    }
+
+  opera_cdrom_set_callbacks(mb_cdrom_get_size,
+                            mb_cdrom_set_sector,
+                            mb_cdrom_read_sector);
+  opera_cpu_override(features);
+  if(opera_3do_init(mb_callback) == -1)
+    {
+      fprintf(stderr,"unable to allocate emulator memory\n");
+      return 1;
+    }
+  opera_region_set_NTSC();
+
+  VIDEO = calloc(opera_region_max_width() * opera_region_max_height() * 4,
+                 sizeof(uint32_t));
+
+  mb_print_host();
+  for(i = 0; i < KERNEL_COUNT; i++)
+    {
+      if(filter && !strstr(KERNELS[i].name,filter))
+        continue;
+      mb_measure(&KERNELS[i],min_seconds);
+    }
+
+  opera_3do_destroy();
+  free(VIDEO);
+  free(KERNELS);
+
+  return 0;
+}
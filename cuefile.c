@@ -105,6 +105,7 @@ cueFile *cue_get(const char *path)
 
    cue = (cueFile *)malloc(sizeof(cueFile));
    cue->cd_format = CUE_MODE_UNKNOWN;
+   cue->cd_image  = NULL;
 
    while ((filestream_gets(cue_file, line, STRING_MAX)))
    {
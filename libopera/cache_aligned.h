@@ -0,0 +1,18 @@
+#ifndef LIBOPERA_CACHE_ALIGNED_H_INCLUDED
+#define LIBOPERA_CACHE_ALIGNED_H_INCLUDED
+
+/* keeps hot chip state from sharing cache lines with its neighbours */
+
+#ifndef CACHE_ALIGNED
+
+#if defined(_MSC_VER)
+#define CACHE_ALIGNED __declspec(align(64))
+#elif defined(__GNUC__)
+#define CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define CACHE_ALIGNED
+#endif
+
+#endif /* CACHE_ALIGNED */
+
+#endif /* LIBOPERA_CACHE_ALIGNED_H_INCLUDED */
@@ -28,30 +28,38 @@
   *  Felix Lazarev
   */
 
+#include "opera_arena.h"
 #include "opera_arm.h"
 #include "opera_clio.h"
 #include "opera_clock.h"
 #include "opera_core.h"
+#include "opera_cpu.h"
 #include "opera_diag_port.h"
+#include "opera_dirty.h"
 #include "opera_dsp.h"
+#include "opera_hires.h"
 #include "opera_madam.h"
+#include "opera_perf.h"
 #include "opera_region.h"
 #include "opera_sport.h"
+#include "opera_trace.h"
 #include "opera_vdlp.h"
 #include "opera_xbus.h"
 #include "opera_xbus_cdrom_plugin.h"
 #include "inline.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 #include <stdlib.h>
 
-static opera_ext_interface_t io_interface;
+static THREAD_LOCAL opera_ext_interface_t io_interface;
+static THREAD_LOCAL int                   g_FIELD = 0;
 
-extern int flagtime;
+extern THREAD_LOCAL int flagtime;
 
-int      HIRESMODE = 0;
-uint32_t FIXMODE   = 0;
-int      CNBFIX    = 0;
+THREAD_LOCAL int      HIRESMODE = 0;
+THREAD_LOCAL uint32_t FIXMODE   = 0;
+THREAD_LOCAL int      CNBFIX    = 0;
 
 int
 opera_3do_init(opera_ext_interface_t callback_)
@@ -64,12 +72,22 @@ opera_3do_init(opera_ext_interface_t callback_)
 
   CNBFIX = 0;
 
+  if(opera_arena_init(OPERA_ARENA_SIZE) == -1)
+    return -1;
+
+  opera_cpu_init();
   opera_clock_init();
 
-  opera_arm_init();
+  if(opera_arm_init() == -1)
+    {
+      opera_arm_destroy();
+      opera_arena_destroy();
+      return -1;
+    }
 
   dram = opera_arm_ram_get();
   vram = opera_arm_vram_get();
+  opera_dirty_mark_all();
 
   opera_vdlp_init(vram);
   opera_sport_init(vram);
@@ -123,6 +141,8 @@ opera_3do_destroy()
 {
   opera_arm_destroy();
   opera_xbus_destroy();
+  opera_hires_destroy();
+  opera_arena_destroy();
 }
 
 static
@@ -133,23 +153,38 @@ opera_3do_internal_frame(uint32_t  cycles_,
                          int       field_)
 {
   opera_clock_push_cycles(cycles_);
+  opera_xbus_tick(cycles_);
   if(opera_clock_dsp_queued())
-    io_interface(EXT_DSP_TRIGGER,NULL);
+    {
+      OPERA_TRACE_BEGIN("dsp");
+      OPERA_PERF_BEGIN(OPERA_PERF_DSP);
+      io_interface(EXT_DSP_TRIGGER,NULL);
+      OPERA_PERF_END(OPERA_PERF_DSP);
+      OPERA_TRACE_END("dsp");
+    }
 
   if(opera_clock_timer_queued())
     opera_clio_timer_execute();
 
   if(opera_clock_vdl_queued())
     {
+      OPERA_PERF_BEGIN(OPERA_PERF_VDLP);
+
       opera_clio_vcnt_update(*line_,field_);
       opera_vdlp_process_line(*line_);
 
+      OPERA_PERF_END(OPERA_PERF_VDLP);
+      OPERA_PERF_COUNT(OPERA_PERF_VDLP_LINES,1);
+
       if(*line_ == opera_clio_line_vint0())
         opera_clio_fiq_generate(1<<0,0);
 
       if(*line_ == opera_clio_line_vint1())
         opera_clio_fiq_generate(1<<1,0);
 
+      OPERA_TRACE_END_ARG("scanline","line",*line_);
+      OPERA_TRACE_BEGIN("scanline");
+
       (*line_)++;
     }
 }
@@ -158,9 +193,12 @@ void
 opera_3do_process_frame(void)
 {
   int32_t cnt;
+  int32_t cycles;
+  uint32_t ccbs;
   uint32_t line;
   uint32_t scanlines;
-  static int field = 0;
+  OPERA_PERF_BEGIN(OPERA_PERF_ARM);
+  OPERA_TRACE_BEGIN("frame");
 
   if(flagtime)
     flagtime--;
@@ -168,23 +206,38 @@ opera_3do_process_frame(void)
   cnt  = 0;
   line = 0;
   scanlines = opera_region_scanlines();
+  OPERA_TRACE_BEGIN("scanline");
   do
     {
       if(opera_madam_fsm_get() == FSM_INPROCESS)
         {
-          opera_madam_cel_handle();
+          OPERA_TRACE_BEGIN("cel list");
+          OPERA_PERF_BEGIN(OPERA_PERF_MADAM);
+          ccbs = opera_madam_cel_handle();
           opera_madam_fsm_set(FSM_IDLE);
+          OPERA_PERF_END(OPERA_PERF_MADAM);
+          OPERA_TRACE_END_ARG("cel list","ccbs",ccbs);
         }
 
-      cnt += opera_arm_execute();
+      cycles = opera_arm_execute();
+      OPERA_PERF_COUNT(OPERA_PERF_ARM_INSNS,1);
+      OPERA_PERF_COUNT(OPERA_PERF_ARM_CYCLES,cycles);
+
+      cnt += cycles;
       if(cnt >= 32)
         {
-          opera_3do_internal_frame(cnt,&line,field);
+          opera_3do_internal_frame(cnt,&line,g_FIELD);
           cnt -= 32;
         }
     } while(line < scanlines);
 
-  field = !field;
+  /* the scanline opened after the last line is closed empty */
+  OPERA_TRACE_END("scanline");
+  OPERA_TRACE_END_ARG("frame","field",g_FIELD);
+
+  g_FIELD = !g_FIELD;
+
+  OPERA_PERF_END(OPERA_PERF_ARM);
 }
 
 uint32_t
@@ -251,8 +304,92 @@ opera_3do_state_load(const void *buf_)
   opera_arm_state_load(&data[indexes[1]]);
   opera_vdlp_state_load(&data[indexes[2]]);
   opera_dsp_state_load(&data[indexes[3]]);
+  /* before CLIO, which rebases its timers on the restored ticks */
+  opera_clock_state_load(&data[indexes[5]]);
   opera_clio_state_load(&data[indexes[4]]);
+  opera_sport_state_load(&data[indexes[6]]);
+  opera_madam_state_load(&data[indexes[7]]);
+  opera_xbus_state_load(&data[indexes[8]]);
+
+  return 1;
+}
+
+/*
+  Same layout as the full state but with only the ARM registers and
+  NVRAM in place of the ARM block, DRAM/VRAM being handled by the
+  caller (see opera_delta). The spare header slot after the offsets
+  holds the field parity so a restored frame interlaces the same way.
+*/
+uint32_t
+opera_3do_chip_state_size(void)
+{
+  uint32_t tmp;
+
+  tmp  = 0;
+  tmp += 16 * 4;
+  tmp += opera_arm_core_state_size();
+  tmp += opera_vdlp_state_size();
+  tmp += opera_dsp_state_size();
+  tmp += opera_clio_state_size();
+  tmp += opera_clock_state_size();
+  tmp += opera_sport_state_size();
+  tmp += opera_madam_state_size();
+  tmp += opera_xbus_state_size();
+
+  return tmp;
+}
+
+void
+opera_3do_chip_state_save(void *buf_)
+{
+  uint8_t *data;
+  uint32_t *indexes;
+
+  data    = buf_;
+  indexes = buf_;
+
+  indexes[0] = 0x97970102;
+  indexes[1] = 16 * 4;
+  indexes[2] = indexes[1] + opera_arm_core_state_size();
+  indexes[3] = indexes[2] + opera_vdlp_state_size();
+  indexes[4] = indexes[3] + opera_dsp_state_size();
+  indexes[5] = indexes[4] + opera_clio_state_size();
+  indexes[6] = indexes[5] + opera_clock_state_size();
+  indexes[7] = indexes[6] + opera_sport_state_size();
+  indexes[8] = indexes[7] + opera_madam_state_size();
+  indexes[9] = indexes[8] + opera_xbus_state_size();
+  indexes[10] = g_FIELD;
+
+  opera_arm_core_state_save(&data[indexes[1]]);
+  opera_vdlp_state_save(&data[indexes[2]]);
+  opera_dsp_state_save(&data[indexes[3]]);
+  opera_clio_state_save(&data[indexes[4]]);
+  opera_clock_state_save(&data[indexes[5]]);
+  opera_sport_state_save(&data[indexes[6]]);
+  opera_madam_state_save(&data[indexes[7]]);
+  opera_xbus_state_save(&data[indexes[8]]);
+}
+
+int
+opera_3do_chip_state_load(const void *buf_)
+{
+  const uint8_t *data;
+  const uint32_t *indexes;
+
+  data    = buf_;
+  indexes = buf_;
+
+  if(indexes[0] != 0x97970102)
+    return 0;
+
+  g_FIELD = indexes[10];
+
+  opera_arm_core_state_load(&data[indexes[1]]);
+  opera_vdlp_state_load(&data[indexes[2]]);
+  opera_dsp_state_load(&data[indexes[3]]);
+  /* before CLIO, which rebases its timers on the restored ticks */
   opera_clock_state_load(&data[indexes[5]]);
+  opera_clio_state_load(&data[indexes[4]]);
   opera_sport_state_load(&data[indexes[6]]);
   opera_madam_state_load(&data[indexes[7]]);
   opera_xbus_state_load(&data[indexes[8]]);
@@ -10,6 +10,10 @@ uint32_t opera_3do_state_size(void);
 void     opera_3do_state_save(void *buf);
 int      opera_3do_state_load(const void *buf);
 
+uint32_t opera_3do_chip_state_size(void);
+void     opera_3do_chip_state_save(void *buf);
+int      opera_3do_chip_state_load(const void *buf);
+
 int      opera_3do_init(opera_ext_interface_t callback);
 void     opera_3do_destroy(void);
 
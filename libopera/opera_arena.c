@@ -0,0 +1,162 @@
+#include "opera_arena.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#define ARENA_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#define ARENA_HUGEPAGE_SIZE (2 * 1024 * 1024)
+#define ARENA_ROUND(X,A)    ((((X) + (A) - 1) / (A)) * (A))
+
+struct opera_arena_s
+{
+  uint8_t *base;
+  size_t   size;
+  size_t   used;
+  void    *block;
+  size_t   block_size;
+  int      mapped;
+};
+
+typedef struct opera_arena_s opera_arena_t;
+
+static THREAD_LOCAL opera_arena_t ARENA = {0};
+
+#ifdef ARENA_MMAP
+static
+int
+arena_map(const size_t size_)
+{
+  void *p;
+  uint8_t *head;
+  uint8_t *aligned;
+  size_t span;
+
+#if defined(OPERA_ARENA_HUGETLB) && defined(MAP_HUGETLB) && !defined(DEBUG)
+  p = mmap(NULL,size_,
+           PROT_READ|PROT_WRITE,
+           MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB,
+           -1,0);
+  if(p != MAP_FAILED)
+    {
+      ARENA.base       = p;
+      ARENA.block      = p;
+      ARENA.block_size = size_;
+      ARENA.mapped     = 1;
+      return 0;
+    }
+#endif
+
+  /* over map so the usable range can start on a hugepage boundary */
+  span = (size_ + ARENA_HUGEPAGE_SIZE);
+  p = mmap(NULL,span,
+           PROT_READ|PROT_WRITE,
+           MAP_PRIVATE|MAP_ANONYMOUS,
+           -1,0);
+  if(p == MAP_FAILED)
+    return -1;
+
+  head    = p;
+  aligned = (uint8_t*)ARENA_ROUND((uintptr_t)head,ARENA_HUGEPAGE_SIZE);
+  if(aligned != head)
+    munmap(head,aligned - head);
+  if((head + span) != (aligned + size_))
+    munmap(aligned + size_,(head + span) - (aligned + size_));
+
+#ifdef MADV_HUGEPAGE
+  madvise(aligned,size_,MADV_HUGEPAGE);
+#endif
+
+  ARENA.base       = aligned;
+  ARENA.block      = aligned;
+  ARENA.block_size = size_;
+  ARENA.mapped     = 1;
+
+  return 0;
+}
+#endif
+
+int
+opera_arena_init(const size_t size_)
+{
+  size_t size;
+
+  opera_arena_destroy();
+
+  size = ARENA_ROUND(size_,ARENA_HUGEPAGE_SIZE);
+
+#ifdef ARENA_MMAP
+  if(arena_map(size) == 0)
+    {
+      ARENA.size = size;
+      ARENA.used = 0;
+      return 0;
+    }
+#endif
+
+  ARENA.block = calloc(size + OPERA_ARENA_ALIGN,1);
+  if(ARENA.block == NULL)
+    return -1;
+
+  ARENA.base   = (uint8_t*)ARENA_ROUND((uintptr_t)ARENA.block,OPERA_ARENA_ALIGN);
+  ARENA.size   = size;
+  ARENA.used   = 0;
+  ARENA.mapped = 0;
+
+  return 0;
+}
+
+void
+opera_arena_destroy(void)
+{
+  if(ARENA.block == NULL)
+    return;
+
+#ifdef ARENA_MMAP
+  if(ARENA.mapped)
+    munmap(ARENA.block,ARENA.block_size);
+  else
+    free(ARENA.block);
+#else
+  free(ARENA.block);
+#endif
+
+  memset(&ARENA,0,sizeof(ARENA));
+}
+
+/* NULL if the arena wasn't created or is exhausted */
+void*
+opera_arena_alloc(const size_t size_)
+{
+  size_t size;
+  uint8_t *p;
+#if defined(ARENA_MMAP) && defined(DEBUG)
+  size_t page;
+#endif
+
+  if(ARENA.base == NULL)
+    return NULL;
+
+#if defined(ARENA_MMAP) && defined(DEBUG)
+  page = (size_t)sysconf(_SC_PAGESIZE);
+  size = (ARENA_ROUND(size_,page) + page);
+#else
+  size = ARENA_ROUND(size_,OPERA_ARENA_ALIGN);
+#endif
+  if(size > (ARENA.size - ARENA.used))
+    return NULL;
+
+  p = &ARENA.base[ARENA.used];
+#if defined(ARENA_MMAP) && defined(DEBUG)
+  mprotect(p + size - page,page,PROT_NONE);
+#endif
+  ARENA.used += size;
+
+  return p;
+}
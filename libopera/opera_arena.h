@@ -0,0 +1,35 @@
+#ifndef LIBOPERA_ARENA_H_INCLUDED
+#define LIBOPERA_ARENA_H_INCLUDED
+
+#include "extern_c.h"
+
+#include <stddef.h>
+
+/*
+  Single bump allocated block for all emulator owned memory: DRAM,
+  VRAM, ROM1/2, NVRAM, the hires surface and the frontend's video
+  buffer. Created by opera_3do_init() and released as a whole by
+  opera_3do_destroy(); there is no per allocation free.
+
+  On Linux it is an anonymous mapping aligned to 2MiB and advised for
+  transparent hugepages. Building with OPERA_ARENA_HUGETLB first tries
+  explicit hugepages (MAP_HUGETLB) from the system's reserved pool.
+  Elsewhere it falls back to calloc. Allocations are zeroed and cache
+  line aligned. DEBUG builds on Linux follow every allocation with an
+  inaccessible guard page.
+*/
+
+/* ~5MiB guest memory, 3MiB hires surface, <2MiB video plus guard pages */
+#define OPERA_ARENA_SIZE  (12 * 1024 * 1024)
+#define OPERA_ARENA_ALIGN 64
+
+EXTERN_C_BEGIN
+
+int   opera_arena_init(const size_t size_);
+void  opera_arena_destroy(void);
+
+void *opera_arena_alloc(const size_t size_);
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_ARENA_H_INCLUDED */
@@ -29,19 +29,27 @@
 */
 
 #include "bool.h"
+#include "cache_aligned.h"
 #include "endianness.h"
 #include "hack_flags.h"
 #include "inline.h"
+#include "opera_arena.h"
 #include "opera_arm.h"
 #include "opera_arm_core.h"
 #include "opera_clio.h"
 #include "opera_core.h"
+#include "opera_cpu.h"
 #include "opera_diag_port.h"
+#include "opera_dirty.h"
 #include "opera_fixedpoint_math.h"
+#include "opera_hires.h"
 #include "opera_madam.h"
+#include "opera_prof.h"
 #include "opera_sport.h"
 #include "opera_swi_hle_0x5XXXX.h"
+#include "thread_local.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -110,14 +118,14 @@ const static uint16_t cond_flags_cross[]=
 
 #define DRAM_SIZE  ( 2 * 1024 * 1024)
 #define VRAM_SIZE  ( 1 * 1024 * 1024)
-#define RAM_SIZE   ( 3 * 1024 * 1024)
+#define RAM_SIZE   OPERA_RAM_SIZE
 #define ROM1_SIZE  ( 1 * 1024 * 1024)
 #define ROM2_SIZE  ( 1 * 1024 * 1024)
 #define NVRAM_SIZE (32 * 1024)
 
-static int        g_SWI_HLE;
-static arm_core_t CPU;
-static int        CYCLES;	//cycle counter
+static THREAD_LOCAL int        g_SWI_HLE;
+static THREAD_LOCAL CACHE_ALIGNED arm_core_t CPU;
+static THREAD_LOCAL int        CYCLES;	//cycle counter
 
 static uint32_t readusr(uint32_t rn);
 static void     loadusr(uint32_t rn, uint32_t val);
@@ -159,7 +167,8 @@ opera_arm_rom1_byteswap_if_necessary(void)
   rom  = opera_arm_rom1_get();
   size = opera_arm_rom1_size();
 
-  swap32_array_if_little_endian((uint32_t*)rom,(size / sizeof(uint32_t)));
+  if(is_little_endian())
+    OPERA_CPU.bswap32((uint32_t*)rom,(size / sizeof(uint32_t)));
 }
 
 uint8_t*
@@ -183,7 +192,8 @@ opera_arm_rom2_byteswap_if_necessary(void)
   rom  = opera_arm_rom2_get();
   size = opera_arm_rom2_size();
 
-  swap32_array_if_little_endian((uint32_t*)rom,(size / sizeof(uint32_t)));
+  if(is_little_endian())
+    OPERA_CPU.bswap32((uint32_t*)rom,(size / sizeof(uint32_t)));
 }
 
 uint8_t*
@@ -228,7 +238,6 @@ opera_arm_state_save(void *buf_)
 void
 opera_arm_state_load(const void *buf_)
 {
-  uint8_t i;
   uint8_t *ram   = CPU.ram;
   uint8_t *rom1  = CPU.rom1;
   uint8_t *rom2  = CPU.rom2;
@@ -239,283 +248,110 @@ opera_arm_state_load(const void *buf_)
   memcpy(rom1,((uint8_t*)buf_)+sizeof(arm_core_t)+RAM_SIZE,ROM1_SIZE);
   memcpy(nvram,((uint8_t*)buf_)+sizeof(arm_core_t)+RAM_SIZE+ROM1_SIZE,NVRAM_SIZE);
 
-  for(i = 3; i < 18; i++)
-    memcpy(ram + (i * 1024 * 1024),
-           ram + (2 * 1024 * 1024),
-           1024 * 1024);
-
   CPU.ram   = ram;
   CPU.rom1  = rom1;
   CPU.rom2  = rom2;
   CPU.nvram = nvram;
-}
 
-static
-void
-ARM_RestUserRONS(void)
-{
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      break;
-    case ARM_MODE_FIQ:
-      memcpy(CPU.FIQ,&CPU.USER[8],7<<2);
-      memcpy(&CPU.USER[8],CPU.CASH,7<<2);
-      break;
-    case ARM_MODE_IRQ:
-      CPU.IRQ[0]   = CPU.USER[13];
-      CPU.IRQ[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.CASH[5];
-      CPU.USER[14] = CPU.CASH[6];
-      break;
-    case ARM_MODE_SVC:
-      CPU.SVC[0]   = CPU.USER[13];
-      CPU.SVC[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.CASH[5];
-      CPU.USER[14] = CPU.CASH[6];
-      break;
-    case ARM_MODE_ABT:
-      CPU.ABT[0]   = CPU.USER[13];
-      CPU.ABT[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.CASH[5];
-      CPU.USER[14] = CPU.CASH[6];
-      break;
-    case ARM_MODE_UND:
-      CPU.UND[0]   = CPU.USER[13];
-      CPU.UND[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.CASH[5];
-      CPU.USER[14] = CPU.CASH[6];
-      break;
-    }
+  opera_dirty_mark_all();
+  opera_hires_reset();
 }
 
-static
-void
-ARM_RestFiqRONS(void)
+/* CPU registers and NVRAM only. DRAM/VRAM are left to the caller. */
+uint32_t
+opera_arm_core_state_size(void)
 {
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      memcpy(CPU.CASH,&CPU.USER[8],7<<2);
-      memcpy(&CPU.USER[8],CPU.FIQ,7<<2);
-      break;
-    case ARM_MODE_FIQ:
-      break;
-    case ARM_MODE_IRQ:
-      memcpy(CPU.CASH,&CPU.USER[8],5<<2);
-      CPU.IRQ[0] = CPU.USER[13];
-      CPU.IRQ[1] = CPU.USER[14];
-      memcpy(&CPU.USER[8],CPU.FIQ,7<<2);
-      break;
-    case ARM_MODE_SVC:
-      memcpy(CPU.CASH,&CPU.USER[8],5<<2);
-      CPU.SVC[0] = CPU.USER[13];
-      CPU.SVC[1] = CPU.USER[14];
-      memcpy(&CPU.USER[8],CPU.FIQ,7<<2);
-      break;
-    case ARM_MODE_ABT:
-      memcpy(CPU.CASH,&CPU.USER[8],5<<2);
-      CPU.ABT[0] = CPU.USER[13];
-      CPU.ABT[1] = CPU.USER[14];
-      memcpy(&CPU.USER[8],CPU.FIQ,7<<2);
-      break;
-    case ARM_MODE_UND:
-      memcpy(CPU.CASH,&CPU.USER[8],5<<2);
-      CPU.UND[0] = CPU.USER[13];
-      CPU.UND[1] = CPU.USER[14];
-      memcpy(&CPU.USER[8],CPU.FIQ,7<<2);
-      break;
-    }
+  return (sizeof(arm_core_t) + NVRAM_SIZE);
 }
 
-static
 void
-ARM_RestIrqRONS(void)
+opera_arm_core_state_save(void *buf_)
 {
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      CPU.CASH[5]  = CPU.USER[13];
-      CPU.CASH[6]  = CPU.USER[14];
-      CPU.USER[13] = CPU.IRQ[0];
-      CPU.USER[14] = CPU.IRQ[1];
-      break;
-    case ARM_MODE_FIQ:
-      memcpy(CPU.FIQ,&CPU.USER[8],7<<2);
-      memcpy(&CPU.USER[8],CPU.CASH,5<<2);
-      CPU.USER[13] = CPU.IRQ[0];
-      CPU.USER[14] = CPU.IRQ[1];
-      break;
-    case ARM_MODE_IRQ:
-      break;
-    case ARM_MODE_SVC:
-      CPU.SVC[0]   = CPU.USER[13];
-      CPU.SVC[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.IRQ[0];
-      CPU.USER[14] = CPU.IRQ[1];
-      break;
-    case ARM_MODE_ABT:
-      CPU.ABT[0]   = CPU.USER[13];
-      CPU.ABT[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.IRQ[0];
-      CPU.USER[14] = CPU.IRQ[1];
-      break;
-    case ARM_MODE_UND:
-      CPU.UND[0]   = CPU.USER[13];
-      CPU.UND[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.IRQ[0];
-      CPU.USER[14] = CPU.IRQ[1];
-      break;
-    }
+  memcpy(buf_,&CPU,sizeof(arm_core_t));
+  memcpy(((uint8_t*)buf_)+sizeof(arm_core_t),CPU.nvram,NVRAM_SIZE);
 }
 
-static
 void
-ARM_RestSvcRONS(void)
+opera_arm_core_state_load(const void *buf_)
 {
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      CPU.CASH[5]  = CPU.USER[13];
-      CPU.CASH[6]  = CPU.USER[14];
-      CPU.USER[13] = CPU.SVC[0];
-      CPU.USER[14] = CPU.SVC[1];
-      break;
-    case ARM_MODE_FIQ:
-      memcpy(CPU.FIQ,&CPU.USER[8],7<<2);
-      memcpy(&CPU.USER[8],CPU.CASH,5<<2);
-      CPU.USER[13] = CPU.SVC[0];
-      CPU.USER[14] = CPU.SVC[1];
-      break;
-    case ARM_MODE_IRQ:
-      CPU.IRQ[0]   = CPU.USER[13];
-      CPU.IRQ[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.SVC[0];
-      CPU.USER[14] = CPU.SVC[1];
-      break;
-    case ARM_MODE_SVC:
-      break;
-    case ARM_MODE_ABT:
-      CPU.ABT[0]   = CPU.USER[13];
-      CPU.ABT[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.SVC[0];
-      CPU.USER[14] = CPU.SVC[1];
-      break;
-    case ARM_MODE_UND:
-      CPU.UND[0]   = CPU.USER[13];
-      CPU.UND[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.SVC[0];
-      CPU.USER[14] = CPU.SVC[1];
-      break;
-    }
+  uint8_t *ram   = CPU.ram;
+  uint8_t *rom1  = CPU.rom1;
+  uint8_t *rom2  = CPU.rom2;
+  uint8_t *nvram = CPU.nvram;
+
+  memcpy(&CPU,buf_,sizeof(arm_core_t));
+  memcpy(nvram,((uint8_t*)buf_)+sizeof(arm_core_t),NVRAM_SIZE);
+
+  CPU.ram   = ram;
+  CPU.rom1  = rom1;
+  CPU.rom2  = rom2;
+  CPU.nvram = nvram;
 }
 
+/*
+  Where each of r8-r14 is kept while a mode isn't the current one, as
+  an offset into arm_core_t. CPU.USER always holds the live registers
+  so the interpreter never indirects; a mode switch only moves the
+  registers whose home differs between the two modes: none for the
+  same mode, r13-r14 between the non FIQ modes and r8-r14 to or from
+  FIQ.
+*/
+#define ARM_BANK(FIELD,IDX) (offsetof(arm_core_t,FIELD) + ((IDX) * sizeof(uint32_t)))
+#define ARM_BANK_R8_R12(FIELD)                                    \
+  ARM_BANK(FIELD,0),ARM_BANK(FIELD,1),ARM_BANK(FIELD,2),          \
+  ARM_BANK(FIELD,3),ARM_BANK(FIELD,4)
+
+static const uint16_t arm_bank_table[6][7] =
+  {
+    [ARM_MODE_USER] = {ARM_BANK_R8_R12(CASH),ARM_BANK(CASH,5),ARM_BANK(CASH,6)},
+    [ARM_MODE_FIQ]  = {ARM_BANK_R8_R12(FIQ), ARM_BANK(FIQ,5), ARM_BANK(FIQ,6)},
+    [ARM_MODE_IRQ]  = {ARM_BANK_R8_R12(CASH),ARM_BANK(IRQ,0), ARM_BANK(IRQ,1)},
+    [ARM_MODE_SVC]  = {ARM_BANK_R8_R12(CASH),ARM_BANK(SVC,0), ARM_BANK(SVC,1)},
+    [ARM_MODE_ABT]  = {ARM_BANK_R8_R12(CASH),ARM_BANK(ABT,0), ARM_BANK(ABT,1)},
+    [ARM_MODE_UND]  = {ARM_BANK_R8_R12(CASH),ARM_BANK(UND,0), ARM_BANK(UND,1)}
+  };
+
 static
-void
-ARM_RestAbtRONS(void)
+FORCEINLINE
+uint32_t*
+arm_bank_slot(const uint32_t mode_,
+              const uint32_t idx_)
 {
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      CPU.CASH[5]  = CPU.USER[13];
-      CPU.CASH[6]  = CPU.USER[14];
-      CPU.USER[13] = CPU.ABT[0];
-      CPU.USER[14] = CPU.ABT[1];
-      break;
-    case ARM_MODE_FIQ:
-      memcpy(CPU.FIQ,&CPU.USER[8],7<<2);
-      memcpy(&CPU.USER[8],CPU.CASH,5<<2);
-      CPU.USER[13] = CPU.ABT[0];
-      CPU.USER[14] = CPU.ABT[1];
-      break;
-    case ARM_MODE_IRQ:
-      CPU.IRQ[0]   = CPU.USER[13];
-      CPU.IRQ[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.ABT[0];
-      CPU.USER[14] = CPU.ABT[1];
-      break;
-    case ARM_MODE_SVC:
-      CPU.SVC[0]   = CPU.USER[13];
-      CPU.SVC[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.ABT[0];
-      CPU.USER[14] = CPU.ABT[1];
-      break;
-    case ARM_MODE_ABT:
-      break;
-    case ARM_MODE_UND:
-      CPU.UND[0]   = CPU.USER[13];
-      CPU.UND[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.ABT[0];
-      CPU.USER[14] = CPU.ABT[1];
-      break;
-    }
+  return (uint32_t*)((uint8_t*)&CPU + arm_bank_table[mode_][idx_]);
 }
 
+/* r8-r14 of mode_ that shadow the user bank, which is then in CASH */
 static
-void
-ARM_RestUndRONS(void)
+FORCEINLINE
+int
+arm_bank_is_banked(const uint32_t mode_,
+                   const uint32_t rn_)
 {
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      CPU.CASH[5]  = CPU.USER[13];
-      CPU.CASH[6]  = CPU.USER[14];
-      CPU.USER[13] = CPU.UND[0];
-      CPU.USER[14] = CPU.UND[1];
-      break;
-    case ARM_MODE_FIQ:
-      memcpy(CPU.FIQ,&CPU.USER[8],7<<2);
-      memcpy(&CPU.USER[8],CPU.CASH,5<<2);
-      CPU.USER[13] = CPU.UND[0];
-      CPU.USER[14] = CPU.UND[1];
-      break;
-    case ARM_MODE_IRQ:
-      CPU.IRQ[0]   = CPU.USER[13];
-      CPU.IRQ[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.UND[0];
-      CPU.USER[14] = CPU.UND[1];
-      break;
-    case ARM_MODE_SVC:
-      CPU.SVC[0]   = CPU.USER[13];
-      CPU.SVC[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.UND[0];
-      CPU.USER[14] = CPU.UND[1];
-      break;
-    case ARM_MODE_ABT:
-      CPU.ABT[0]   = CPU.USER[13];
-      CPU.ABT[1]   = CPU.USER[14];
-      CPU.USER[13] = CPU.UND[0];
-      CPU.USER[14] = CPU.UND[1];
-      break;
-    case ARM_MODE_UND:
-      break;
-    }
+  return ((rn_ >= 8) &&
+          (arm_bank_table[mode_][rn_ - 8] != arm_bank_table[ARM_MODE_USER][rn_ - 8]));
 }
 
+/* switching to or from an undefined mode leaves the registers alone */
 static
 void
-ARM_Change_ModeSafe(uint32_t mode_)
+arm_bank_switch(uint32_t mode_)
 {
-  switch(arm_mode_table[mode_ & 0x1F])
+  uint32_t i;
+  uint32_t to;
+  uint32_t from;
+
+  from = arm_mode_table[CPU.CPSR & 0x1F];
+  to   = arm_mode_table[mode_ & 0x1F];
+  if((from == to) || (from == ARM_MODE_UNK) || (to == ARM_MODE_UNK))
+    return;
+
+  for(i = 0; i < 7; i++)
     {
-    case ARM_MODE_USER:
-      ARM_RestUserRONS();
-      break;
-    case ARM_MODE_FIQ:
-      ARM_RestFiqRONS();
-      break;
-    case ARM_MODE_IRQ:
-      ARM_RestIrqRONS();
-      break;
-    case ARM_MODE_SVC:
-      ARM_RestSvcRONS();
-      break;
-    case ARM_MODE_ABT:
-      ARM_RestAbtRONS();
-      break;
-    case ARM_MODE_UND:
-      ARM_RestUndRONS();
-      break;
+      if(arm_bank_table[from][i] == arm_bank_table[to][i])
+        continue;
+
+      *arm_bank_slot(from,i) = CPU.USER[8 + i];
+      CPU.USER[8 + i] = *arm_bank_slot(to,i);
     }
 }
 
@@ -531,7 +367,7 @@ void
 arm_cpsr_set(uint32_t a_)
 {
   a_ |= 0x10;
-  ARM_Change_ModeSafe(a_);
+  arm_bank_switch(a_);
   CPU.CPSR = (a_ & 0xf00000df);
 }
 
@@ -542,7 +378,7 @@ void
 SETM(uint32_t a_)
 {
   a_ |= 0x10;
-  ARM_Change_ModeSafe(a_);
+  arm_bank_switch(a_);
   CPU.CPSR = ((CPU.CPSR & 0xffffffe0) | (a_ & 0x1F));
 }
 
@@ -613,7 +449,7 @@ ROTR(const uint32_t val_,
           val_);
 }
 
-void
+int
 opera_arm_init(void)
 {
   int i;
@@ -635,37 +471,35 @@ opera_arm_init(void)
   for(i = 0;i < 7; i++)
     CPU.CASH[i] = CPU.FIQ[i] = 0;
 
-  CPU.ram   = calloc(RAM_SIZE + 1024*1024*16,1);
-  CPU.rom1  = calloc(ROM1_SIZE,1);
-  CPU.rom2  = calloc(ROM2_SIZE,1);
+  CPU.ram   = opera_arena_alloc(RAM_SIZE);
+  CPU.rom1  = opera_arena_alloc(ROM1_SIZE);
+  CPU.rom2  = opera_arena_alloc(ROM2_SIZE);
   CPU.rom   = CPU.rom1;
-  CPU.nvram = calloc(NVRAM_SIZE,1);
+  CPU.nvram = opera_arena_alloc(NVRAM_SIZE);
+  if((CPU.ram   == NULL) ||
+     (CPU.rom1  == NULL) ||
+     (CPU.rom2  == NULL) ||
+     (CPU.nvram == NULL))
+    return -1;
 
   CPU.nFIQ = FALSE;
   CPU.MAS_Access_Exept = FALSE;
 
   CPU.USER[15] = ARM_INITIAL_PC;
   arm_cpsr_set(0x13);
+
+  return 0;
 }
 
 void
 opera_arm_destroy(void)
 {
-  if(CPU.nvram)
-    free(CPU.nvram);
+  /* memory is released with the arena */
   CPU.nvram = NULL;
-
-  if(CPU.rom1)
-    free(CPU.rom1);
-  CPU.rom1 = NULL;
-
-  if(CPU.rom2)
-    free(CPU.rom2);
-  CPU.rom2 = NULL;
-
-  if(CPU.ram)
-    free(CPU.ram);
-  CPU.ram = NULL;
+  CPU.rom1  = NULL;
+  CPU.rom2  = NULL;
+  CPU.rom   = NULL;
+  CPU.ram   = NULL;
 }
 
 void
@@ -713,9 +547,84 @@ opera_arm_swi_hle_get(void)
   return g_SWI_HLE;
 }
 
-static int32_t addrr = 0;
-static int32_t vall  = 0;
-static int32_t inuse = 0;
+static THREAD_LOCAL int32_t addrr = 0;
+static THREAD_LOCAL int32_t vall  = 0;
+static THREAD_LOCAL int32_t inuse = 0;
+
+/*
+  Most block transfers are prologues, epilogues and the libc memcpy
+  running over DRAM/VRAM. When the whole range is plain memory it is
+  checked once and the registers moved with direct host accesses
+  rather than one mreadw()/mwritew() dispatch each.
+*/
+static
+FORCEINLINE
+int
+bdt_in_ram(const uint32_t addr_,
+           const uint32_t count_)
+{
+  uint32_t addr;
+
+  addr = (addr_ & ~3);
+
+  return ((addr < RAM_SIZE) && ((RAM_SIZE - addr) >= (count_ << 2)));
+}
+
+static
+void
+ldm_ram(uint32_t       list_,
+        const uint32_t addr_,
+        const uint32_t count_)
+{
+  uint32_t i;
+  uint32_t off;
+  const uint32_t *p;
+
+  /* the STM/LDM pairing tracked for FIX_BIT_TIMING_1 */
+  off = ((uint32_t)addrr - addr_);
+  if((inuse == 1) && (off < (count_ << 2)) && !(off & 3))
+    inuse = 0;
+
+  p = (const uint32_t*)&CPU.ram[addr_ & ~3];
+  for(i = 0; list_; i++, list_ >>= 1)
+    {
+      if(list_ & 1)
+        CPU.USER[i] = *p++;
+    }
+}
+
+static
+void
+stm_ram(uint32_t       list_,
+        const uint32_t addr_,
+        const uint32_t count_)
+{
+  uint32_t i;
+  uint32_t addr;
+  uint32_t *p;
+
+  addr = addr_;
+  p    = (uint32_t*)&CPU.ram[addr_ & ~3];
+  for(i = 0; list_; i++, list_ >>= 1)
+    {
+      if(!(list_ & 1))
+        continue;
+
+      *p = CPU.USER[i];
+      opera_hires_write32(addr & ~3,*p);
+      if(addr & 0x1FFFFF)
+        {
+          addrr = addr;
+          vall  = CPU.USER[i];
+          inuse = 1;
+        }
+
+      p++;
+      addr += 4;
+    }
+
+  opera_dirty_mark_range(addr_ & ~3,count_ << 2);
+}
 
 static
 void
@@ -760,7 +669,17 @@ ldm_accur(uint32_t opc_,
 
   //if(opc_&(1<<21))CPU.USER[rn_ind_]=base_;
 
-  if((opc_ & (1 << 22)) && !(opc_ & 0x8000))
+  /* user bank, no PSR transfer and no load time title fixes */
+  if(!(opc_ & (1 << 22)) &&
+     bdt_in_ram(base_comp,x) &&
+     !((CNBFIX == 0) && (FIXMODE & FIX_BIT_TIMING_1)))
+    {
+      if(opc_ & (1 << 21))
+        CPU.USER[rn_ind_] = base_;
+
+      ldm_ram(list,base_comp,x);
+    }
+  else if((opc_ & (1 << 22)) && !(opc_ & 0x8000))
     {
       if(opc_ & (1 << 21))
         loadusr(rn_ind_,base_);
@@ -873,7 +792,18 @@ stm_accur(uint32_t opc_,
       break;
     }
 
-  if((opc_ & (1 << 22)))
+  if(!(opc_ & (1 << 22)) && bdt_in_ram(base_comp,x))
+    {
+      if((opc_ & (1 << 21)) && (opc_ & ((1 << rn_ind_) - 1)))
+        CPU.USER[rn_ind_] = base_;
+
+      stm_ram(list,base_comp,x);
+      base_comp += ((x - ((opc_ >> 15) & 1)) << 2);
+
+      if(opc_ & (1 << 21))
+        CPU.USER[rn_ind_] = base_;
+    }
+  else if((opc_ & (1 << 22)))
     {
       if((opc_ & (1 << 21)) && (opc_ & ((1 << rn_ind_) - 1)))
         loadusr(rn_ind_,base_);
@@ -971,20 +901,45 @@ decode_swi_lle(void)
   CPU.USER[15] = 0x00000008;
 }
 
+/*
+  The HLE routines write guest RAM through host pointers. A count the
+  routine treats as negative marks more than was written, never less.
+*/
+static
+void
+swi_hle_written(const uint32_t addr_,
+                const uint32_t count_,
+                const uint32_t size_)
+{
+  uint64_t size;
+
+  size = ((uint64_t)count_ * size_);
+  if(size > OPERA_DIRTY_MEM_SIZE)
+    size = OPERA_DIRTY_MEM_SIZE;
+
+  opera_dirty_mark_range(addr_,(uint32_t)size);
+}
+
 static
 void
 decode_swi_hle(const uint32_t op_)
 {
+  uint32_t dest;
+  uint32_t count;
+
   switch(op_ & 0x000FFFFF)
     {
     case 0x50000:
       opera_swi_hle_0x50000(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2]);
+      swi_hle_written(CPU.USER[0],1,sizeof(vec3f16));
       return;
     case 0x50001:
       opera_swi_hle_0x50001(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2]);
+      swi_hle_written(CPU.USER[0],1,sizeof(mat33f16));
       return;
     case 0x50002:
       opera_swi_hle_0x50002(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2],CPU.USER[3]);
+      swi_hle_written(CPU.USER[0],CPU.USER[3],sizeof(vec3f16));
       return;
     case 0x50003:
       break;
@@ -992,18 +947,23 @@ decode_swi_hle(const uint32_t op_)
       break;
     case 0x50005:
       opera_swi_hle_0x50005(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2],CPU.USER[3]);
+      swi_hle_written(CPU.USER[0],CPU.USER[3],sizeof(frac16));
       return;
     case 0x50006:
       opera_swi_hle_0x50006(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2],CPU.USER[3]);
+      swi_hle_written(CPU.USER[0],CPU.USER[3],sizeof(frac16));
       return;
     case 0x50007:
       opera_swi_hle_0x50007(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2]);
+      swi_hle_written(CPU.USER[0],1,sizeof(vec4f16));
       return;
     case 0x50008:
       opera_swi_hle_0x50008(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2]);
+      swi_hle_written(CPU.USER[0],1,sizeof(mat44f16));
       return;
     case 0x50009:
       opera_swi_hle_0x50009(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2],CPU.USER[3]);
+      swi_hle_written(CPU.USER[0],CPU.USER[3],sizeof(vec4f16));
       return;
     case 0x5000A:
       break;
@@ -1014,6 +974,7 @@ decode_swi_hle(const uint32_t op_)
       return;
     case 0x5000E:
       opera_swi_hle_0x5000E(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2]);
+      swi_hle_written(CPU.USER[0],1,sizeof(vec3f16));
       return;
     case 0x5000F:
       CPU.USER[0] = opera_swi_hle_0x5000F(CPU.ram,CPU.USER[0]);
@@ -1023,9 +984,13 @@ decode_swi_hle(const uint32_t op_)
       return;
     case 0x50011:
       opera_swi_hle_0x50011(CPU.ram,CPU.USER[0],CPU.USER[1],CPU.USER[2],CPU.USER[3]);
+      swi_hle_written(CPU.USER[0],1,sizeof(vec3f16));
       return;
     case 0x50012:
+      dest  = *(uint32_t*)&CPU.ram[CPU.USER[0] + 0x00];
+      count = *(uint32_t*)&CPU.ram[CPU.USER[0] + 0x10];
       opera_swi_hle_0x50012(CPU.ram,CPU.USER[0]);
+      swi_hle_written(dest,count,sizeof(vec3f16));
       return;
     }
 
@@ -1038,6 +1003,8 @@ decode_swi(const uint32_t op_)
 {
   CYCLES -= (SCYCLE + NCYCLE);  // +2S+1N
 
+  OPERA_PROF_SWI(op_ & 0x00FFFFFF);
+
   if(g_SWI_HLE)
     return decode_swi_hle(op_);
 
@@ -1045,7 +1012,7 @@ decode_swi(const uint32_t op_)
 }
 
 
-static uint32_t carry_out = 0;
+static THREAD_LOCAL uint32_t carry_out = 0;
 
 static
 INLINE
@@ -1529,6 +1496,7 @@ opera_arm_execute(void)
   uint8_t shift;
   uint8_t shtype;
   uint32_t cmd;
+  uint32_t pc;
   uint32_t pc_tmp;
   int isexeption;
 
@@ -1543,7 +1511,8 @@ opera_arm_execute(void)
       CNBFIX = 1;
     }
 
-  cmd = mreadw(CPU.USER[15]);
+  pc  = CPU.USER[15];
+  cmd = mreadw(pc);
   CPU.USER[15] += 4;
 
   CYCLES = -SCYCLE;
@@ -1846,10 +1815,9 @@ opera_arm_execute(void)
         }
     }
 
-  if(!ISF && opera_clio_fiq_needed()/*CPU.nFIQ*/)
+  if(CPU.nFIQ && !ISF)
     {
       //Set_madam_FSM(FSM_SUSPENDED);
-      CPU.nFIQ = FALSE;
       CPU.SPSR[arm_mode_table[0x11]] = CPU.CPSR;
       SETF(1);
       SETI(1);
@@ -1858,61 +1826,70 @@ opera_arm_execute(void)
       CPU.USER[15] = 0x0000001C;
     }
 
+  OPERA_PROF_TICK(pc,CPU.USER[14],-CYCLES);
+
   return -CYCLES;
 }
 
+/*
+  FIQ line driven by CLIO. It stays asserted until the handler clears
+  the source, the F bit keeps the core from re-entering meanwhile.
+*/
+void
+opera_arm_fiq_set(const int level_)
+{
+  CPU.nFIQ = !!level_;
+}
+
 void
 opera_mem_write8(uint32_t addr_,
                  uint8_t  val_)
 {
+  addr_ = opera_ram_bound(addr_,1);
+
   CPU.ram[addr_] = val_;
-  if(!HIRESMODE || (addr_ < 0x200000))
-    return;
-  CPU.ram[addr_ + 1*1024*1024] = val_;
-  CPU.ram[addr_ + 2*1024*1024] = val_;
-  CPU.ram[addr_ + 3*1024*1024] = val_;
+  opera_dirty_mark(addr_);
+  opera_hires_write8(addr_,val_);
 }
 
 void
 opera_mem_write16(uint32_t addr_,
                   uint16_t val_)
 {
+  addr_ = opera_ram_bound(addr_,2);
+
   *((uint16_t*)&CPU.ram[addr_]) = val_;
-  if(!HIRESMODE || (addr_ < 0x200000))
-    return;
-  *((uint16_t*)&CPU.ram[addr_ + 1*1024*1024]) = val_;
-  *((uint16_t*)&CPU.ram[addr_ + 2*1024*1024]) = val_;
-  *((uint16_t*)&CPU.ram[addr_ + 3*1024*1024]) = val_;
+  opera_dirty_mark(addr_);
+  opera_hires_write16(addr_,val_);
 }
 
 void
 opera_mem_write32(uint32_t addr_,
                   uint32_t val_)
 {
+  addr_ = opera_ram_bound(addr_,4);
+
   *((uint32_t*)&CPU.ram[addr_]) = val_;
-  if(!HIRESMODE || (addr_ < 0x200000))
-    return;
-  *((uint32_t*)&CPU.ram[addr_ + 1*1024*1024]) = val_;
-  *((uint32_t*)&CPU.ram[addr_ + 2*1024*1024]) = val_;
-  *((uint32_t*)&CPU.ram[addr_ + 3*1024*1024]) = val_;
+  opera_dirty_mark(addr_);
+  opera_hires_write32(addr_,val_);
 }
 
 uint16_t
 opera_mem_read16(uint32_t addr_)
 {
-  return *((uint16_t*)&CPU.ram[addr_]);
+  return *((uint16_t*)&CPU.ram[opera_ram_bound(addr_,2)]);
 }
 
 uint32_t
 opera_mem_read32(uint32_t addr_)
 {
-  return *((uint32_t*)&CPU.ram[addr_]);
+  return *((uint32_t*)&CPU.ram[opera_ram_bound(addr_,4)]);
 }
 
 uint8_t
 opera_mem_read8(uint32_t addr_)
 {
-  return CPU.ram[addr_];
+  return CPU.ram[opera_ram_bound(addr_,1)];
 }
 
 static
@@ -2062,60 +2039,41 @@ void
 loadusr(uint32_t n_,
         uint32_t val_)
 {
+  uint32_t mode;
+
   if(n_ == 15)
     {
       CPU.USER[15] = val_;
       return;
     }
 
-  switch(arm_mode_table[(CPU.CPSR & 0x1F) | 0x10])
-    {
-    case ARM_MODE_USER:
-      CPU.USER[n_] = val_;
-      break;
-    case ARM_MODE_FIQ:
-      if(n_ > 7)
-        CPU.CASH[n_ - 8] = val_;
-      else
-        CPU.USER[n_] = val_;
-      break;
-    case ARM_MODE_IRQ:
-    case ARM_MODE_ABT:
-    case ARM_MODE_UND:
-    case ARM_MODE_SVC:
-      if(n_ > 12)
-        CPU.CASH[n_ - 8] = val_;
-      else
-        CPU.USER[n_] = val_;
-      break;
-    }
+  mode = arm_mode_table[(CPU.CPSR & 0x1F) | 0x10];
+  if(mode == ARM_MODE_UNK)
+    return;
+
+  if(arm_bank_is_banked(mode,n_))
+    CPU.CASH[n_ - 8] = val_;
+  else
+    CPU.USER[n_] = val_;
 }
 
 static
 uint32_t
 readusr(uint32_t n_)
 {
+  uint32_t mode;
+
   if(n_ == 15)
     return CPU.USER[15];
 
-  switch(arm_mode_table[CPU.CPSR & 0x1F])
-    {
-    case ARM_MODE_USER:
-      return CPU.USER[n_];
-    case ARM_MODE_FIQ:
-      if(n_ > 7)
-        return CPU.CASH[n_ - 8];
-      return CPU.USER[n_];
-    case ARM_MODE_IRQ:
-    case ARM_MODE_ABT:
-    case ARM_MODE_UND:
-    case ARM_MODE_SVC:
-      if(n_ > 12)
-        return CPU.CASH[n_ - 8];
-      return CPU.USER[n_];
-    }
+  mode = arm_mode_table[CPU.CPSR & 0x1F];
+  if(mode == ARM_MODE_UNK)
+    return 0;
 
-  return 0;
+  if(arm_bank_is_banked(mode,n_))
+    return CPU.CASH[n_ - 8];
+
+  return CPU.USER[n_];
 }
 
 uint32_t
@@ -34,11 +34,31 @@
 #include <stdint.h>
 
 #include "extern_c.h"
+#include "inline.h"
+
+#define OPERA_RAM_SIZE (3 * 1024 * 1024)
 
 EXTERN_C_BEGIN
 
+/*
+  Unlike the ARM's, the addresses MADAM, CLIO DMA and the FIFOs use
+  aren't decoded. Any that would run a size_ byte access past the end
+  of guest RAM wrap back into it.
+*/
+static
+FORCEINLINE
+uint32_t
+opera_ram_bound(const uint32_t addr_,
+                const uint32_t size_)
+{
+  if(addr_ <= (OPERA_RAM_SIZE - size_))
+    return addr_;
+
+  return ((addr_ % OPERA_RAM_SIZE) & ~(size_ - 1));
+}
+
 int32_t  opera_arm_execute(void);
-void     opera_arm_init(void);
+int      opera_arm_init(void);
 void     opera_arm_reset(void);
 void     opera_arm_destroy(void);
 
@@ -56,6 +76,10 @@ uint32_t opera_arm_state_size(void);
 void     opera_arm_state_save(void *buf_);
 void     opera_arm_state_load(const void *buf_);
 
+uint32_t opera_arm_core_state_size(void);
+void     opera_arm_core_state_save(void *buf_);
+void     opera_arm_core_state_load(const void *buf_);
+
 uint8_t* opera_arm_nvram_get(void);
 uint64_t opera_arm_nvram_size(void);
 
@@ -78,6 +102,8 @@ uint64_t opera_arm_vram_size(void);
 void     opera_arm_swi_hle_set(const int hle);
 int      opera_arm_swi_hle_get(void);
 
+void     opera_arm_fiq_set(const int level);
+
 EXTERN_C_END
 
 #endif /* LIBOPERA_ARM_H_INCLUDED */
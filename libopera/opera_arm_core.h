@@ -23,7 +23,7 @@ struct arm_core_s
   uint32_t SPSR[6];
   uint32_t CPSR;
 
-  uint8_t nFIQ;                 /* external interrupt */
+  uint8_t nFIQ;                 /* FIQ line, see opera_arm_fiq_set() */
   uint8_t MAS_Access_Exept;	/* memory exceptions */
 };
 
@@ -30,6 +30,9 @@
 
 #include "inline.h"
 #include "opera_cdrom.h"
+#include "opera_perf.h"
+#include "opera_trace.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -41,9 +44,15 @@
 #define SECONDS_PER_MINUTE  60
 
 /* FIXME: should not be using globals */
-opera_cdrom_get_size_cb_t    CDROM_GET_SIZE;
-opera_cdrom_set_sector_cb_t  CDROM_SET_SECTOR;
-opera_cdrom_read_sector_cb_t CDROM_READ_SECTOR;
+THREAD_LOCAL opera_cdrom_get_size_cb_t    CDROM_GET_SIZE;
+THREAD_LOCAL opera_cdrom_set_sector_cb_t  CDROM_SET_SECTOR;
+THREAD_LOCAL opera_cdrom_read_sector_cb_t CDROM_READ_SECTOR;
+
+/*
+  CPU cycles before each block of a READ DATA command is ready. 0
+  completes the command synchronously.
+*/
+static THREAD_LOCAL uint32_t CDROM_READ_DELAY = 0;
 
 static
 INLINE
@@ -86,6 +95,55 @@ opera_cdrom_set_callbacks(opera_cdrom_get_size_cb_t    get_size_,
   CDROM_READ_SECTOR = read_sector_;
 }
 
+void
+opera_cdrom_set_read_delay(const uint32_t cycles_)
+{
+  CDROM_READ_DELAY = cycles_;
+}
+
+static
+void
+cdrom_read_block(cdrom_device_t *cd_)
+{
+  OPERA_PERF_BEGIN(OPERA_PERF_CDROM);
+
+  CDROM_SET_SECTOR(cd_->current_sector++);
+  CDROM_READ_SECTOR(cd_->data);
+
+  OPERA_PERF_END(OPERA_PERF_CDROM);
+  OPERA_PERF_COUNT(OPERA_PERF_CDROM_BYTES,REQSIZE);
+
+  cd_->data_len = REQSIZE;
+  cd_->blocks_requested--;
+}
+
+/*
+  With a read delay every block of a READ DATA waits its turn. The
+  FIFO reports no data until opera_cdrom_tick delivers the block.
+*/
+static
+void
+cdrom_delay_block(cdrom_device_t *cd_)
+{
+  cd_->data_len   = 0;
+  cd_->read_delay = CDROM_READ_DELAY;
+}
+
+/* the command's status is only posted with its first block */
+static
+void
+cdrom_deliver_block(cdrom_device_t *cd_)
+{
+  cd_->read_delay = 0;
+  cdrom_read_block(cd_);
+
+  cd_->poll |= POLDT;
+  if(cd_->status_len > 0)
+    cd_->poll |= POLST;
+
+  OPERA_TRACE_ASYNC_END("cdrom cmd",CDROM_CMD_READ_DATA);
+}
+
 void
 opera_cdrom_init(cdrom_device_t *cd_)
 {
@@ -120,7 +178,8 @@ opera_cdrom_init(cdrom_device_t *cd_)
   LBA2MSF(file_size_in_blocks + MSF_BIAS_IN_FRAMES,&cd_->disc.msf_total);
   LBA2MSF(file_size_in_blocks,&cd_->disc.msf_session);
 
-  cd_->STATCYC = STATDELAY;
+  cd_->STATCYC    = STATDELAY;
+  cd_->read_delay = 0;
 }
 
 uint8_t
@@ -147,7 +206,10 @@ opera_cdrom_do_cmd(cdrom_device_t *cd_)
 {
   int i;
 
+  OPERA_TRACE_ASYNC_BEGIN("cdrom cmd",cd_->cmd[0]);
+
   cd_->status_len = 0;
+  cd_->read_delay = 0;
 
   cd_->poll        &= ~POLST;
   cd_->poll        &= ~POLDT;
@@ -384,21 +446,22 @@ opera_cdrom_do_cmd(cdrom_device_t *cd_)
           cd_->current_sector           = MSF2LBA(&cd_->disc.msf_current);
           cd_->blocks_requested         = ((cd_->cmd[5] << 8) + cd_->cmd[6]);
 
+          cd_->MEI_status = MEI_CDROM_no_error;
+
           CDROM_SET_SECTOR(cd_->current_sector);
-          if(cd_->blocks_requested)
+          if(cd_->blocks_requested && CDROM_READ_DELAY)
             {
-              cd_->current_sector++;
-              CDROM_READ_SECTOR(cd_->data);
-              cd_->data_len = REQSIZE;
-              cd_->blocks_requested--;
+              /* completed by opera_cdrom_tick */
+              cdrom_delay_block(cd_);
+              break;
             }
+
+          if(cd_->blocks_requested)
+            cdrom_read_block(cd_);
           else
-            {
-              cd_->data_len = 0;
-            }
+            cd_->data_len = 0;
 
-          cd_->MEI_status  = MEI_CDROM_no_error;
-          cd_->poll       |= (POLDT | POLST);
+          cd_->poll |= (POLDT | POLST);
         }
       else
         {
@@ -852,6 +915,10 @@ opera_cdrom_do_cmd(cdrom_device_t *cd_)
     default:
       break;
     }
+
+  /* a delayed READ DATA completes in opera_cdrom_tick */
+  if(cd_->read_delay == 0)
+    OPERA_TRACE_ASYNC_END("cdrom cmd",cd_->cmd[0]);
 }
 
 void
@@ -868,6 +935,26 @@ opera_cdrom_send_cmd(cdrom_device_t *cd_,
     }
 }
 
+/*
+  Returns non-zero when a pending READ DATA completes so the bus can
+  raise the XBUS FIQ.
+*/
+int
+opera_cdrom_tick(cdrom_device_t *cd_,
+                 const uint32_t  cycles_)
+{
+  if(cd_->read_delay <= 0)
+    return 0;
+
+  cd_->read_delay -= cycles_;
+  if(cd_->read_delay > 0)
+    return 0;
+
+  cdrom_deliver_block(cd_);
+
+  return 1;
+}
+
 int
 opera_cdrom_test_fiq(cdrom_device_t *cd_)
 {
@@ -887,6 +974,13 @@ opera_cdrom_fifo_get_data(cdrom_device_t *cd_)
 {
   uint8_t rv;
 
+  /*
+    CLIO DMA drains the FIFO in one go and can't be stalled, a
+    transfer reaching a block still in flight gets it immediately
+  */
+  if((cd_->data_len == 0) && (cd_->read_delay > 0))
+    cdrom_deliver_block(cd_);
+
   rv = 0;
   if(cd_->data_len > 0)
     {
@@ -897,12 +991,15 @@ opera_cdrom_fifo_get_data(cdrom_device_t *cd_)
       if(cd_->data_len == 0)
         {
           cd_->data_idx = 0;
-          if(cd_->blocks_requested)
+          if(cd_->blocks_requested && CDROM_READ_DELAY)
+            {
+              cd_->poll &= ~POLDT;
+              cdrom_delay_block(cd_);
+              OPERA_TRACE_ASYNC_BEGIN("cdrom cmd",CDROM_CMD_READ_DATA);
+            }
+          else if(cd_->blocks_requested)
             {
-              CDROM_SET_SECTOR(cd_->current_sector++);
-              CDROM_READ_SECTOR(cd_->data);
-              cd_->data_len = REQSIZE;
-              cd_->blocks_requested--;
+              cdrom_read_block(cd_);
             }
           else
             {
@@ -205,6 +205,7 @@ struct cdrom_device_s
   uint32_t    MEI_status;
   uint32_t    current_sector;
   disc_data_t disc;
+  int32_t     read_delay;
 };
 
 typedef struct cdrom_device_s cdrom_device_t;
@@ -219,6 +220,8 @@ void    opera_cdrom_set_poll(cdrom_device_t *cd_, uint32_t val_);
 int     opera_cdrom_test_fiq(cdrom_device_t *cd_);
 uint8_t opera_cdrom_fifo_get_status(cdrom_device_t *cd_);
 uint8_t opera_cdrom_fifo_get_data(cdrom_device_t *cd_);
+int     opera_cdrom_tick(cdrom_device_t *cd_, const uint32_t cycles_);
+void    opera_cdrom_set_read_delay(const uint32_t cycles_);
 void    opera_cdrom_set_callbacks(opera_cdrom_get_size_cb_t    get_size_,
                                   opera_cdrom_set_sector_cb_t  set_sector_,
                                   opera_cdrom_read_sector_cb_t read_sector_);
@@ -28,12 +28,17 @@
   *  Felix Lazarev
 */
 
+#include "cache_aligned.h"
 #include "opera_arm.h"
 #include "opera_clio.h"
+#include "opera_clio_regs_i.h"
 #include "opera_clock.h"
 #include "opera_dsp.h"
 #include "opera_madam.h"
+#include "opera_perf.h"
+#include "opera_trace.h"
 #include "opera_xbus.h"
+#include "thread_local.h"
 
 #include <string.h>
 
@@ -62,9 +67,24 @@ struct clio_fifo_s
 
 typedef struct clio_fifo_s clio_fifo_t;
 
+/*
+  Register words live in a dense file: the low page (0x000..0x5FC)
+  and the DSPP register page (0x1700..0x17FC). Everything else in
+  the 64K window is either a DSP memory port or unmapped. Peeks and
+  pokes go through the per word handler index generated from
+  opera_clio_regs_i.h.
+*/
+
+#define CLIO_REGS_WORDS 0x180
+#define CLIO_DSPP_WORDS 0x40
+
+#define REG(ADDR)  CLIO.regs[(ADDR) >> 2]
+#define DSPP(ADDR) CLIO.dspp[((ADDR) >> 2) & (CLIO_DSPP_WORDS - 1)]
+
 struct clio_s
 {
-  uint32_t    regs[65536];
+  uint32_t    regs[CLIO_REGS_WORDS];
+  uint32_t    dspp[CLIO_DSPP_WORDS];
   int32_t     dsp_word1;
   int32_t     dsp_word2;
   int32_t     dsp_address;
@@ -74,11 +94,194 @@ struct clio_s
 
 typedef struct clio_s clio_t;
 
-int flagtime;
-int TIMER_VAL = 0; //0x415
+typedef uint32_t (*clio_peek_t)(uint32_t addr_);
+typedef int      (*clio_poke_t)(uint32_t addr_, uint32_t val_);
+
+THREAD_LOCAL int flagtime;
+THREAD_LOCAL int TIMER_VAL = 0; //0x415
+
+static THREAD_LOCAL uint32_t *MADAM_REGS;
+static THREAD_LOCAL CACHE_ALIGNED clio_t CLIO;
+
+/*
+  The ARM samples a single FIQ line after every instruction rather
+  than asking CLIO, so it has to follow every change to the interrupt
+  and mask registers.
+*/
+static
+INLINE
+void
+clio_fiq_update(void)
+{
+  opera_arm_fiq_set(opera_clio_fiq_needed());
+}
+
+/*
+  The 16 timers aren't stepped every tick. Their counters are brought
+  up to the clock's tick count when read or reprogrammed and the clock
+  is told the tick of the next underflow. Between underflows a timer
+  counts down by one per tick if it doesn't cascade or no enabled
+  timer precedes it, otherwise its carry in is zero and it holds.
+*/
+static THREAD_LOCAL uint64_t TIMER_SYNC = 0;
+
+#define TIMER_NONE UINT64_MAX
+
+static
+uint32_t
+timer_flags(const uint32_t timer_)
+{
+  return ((REG((timer_ < 8) ? 0x200 : 0x208) >> ((timer_ << 2) & 0x1F)) & 0xF);
+}
+
+static
+void
+timer_disable(const uint32_t timer_)
+{
+  REG((timer_ < 8) ? 0x200 : 0x208) &= ~(DECREMENT << ((timer_ << 2)));
+}
+
+/* counter followed by its reload value */
+static
+uint32_t*
+timer_regs(const uint32_t timer_)
+{
+  return &REG(0x100 + (timer_ << 3));
+}
+
+/* one tick with at least one underflow, cascading carry in timer order */
+static
+void
+timer_step(void)
+{
+  uint32_t *reg;
+  uint32_t  flags;
+  uint32_t  timer;
+  uint32_t  carry;
+
+  carry = 1;
+  for(timer = 0; timer < 0x10; timer++)
+    {
+      flags = timer_flags(timer);
+      if(!(flags & DECREMENT))
+        continue;
+
+      reg = timer_regs(timer);
+      reg[0] -= ((flags & CASCADE) ? carry : 1);
+      if(reg[0] == 0xFFFFFFFF)
+        {
+          carry = 1;
+          if(timer & 1)
+            opera_clio_fiq_generate(1<<(10-(timer>>1)),0);
+          if(flags & RELOAD)
+            reg[0] = reg[1];
+          else
+            timer_disable(timer);
+        }
+      else
+        {
+          carry = 0;
+        }
+    }
+}
+
+/*
+  Ticks until the next underflow. A cascaded timer already at
+  0xFFFFFFFF "underflows" on a zero carry in so it is due next tick.
+*/
+static
+uint64_t
+timer_next_underflow(void)
+{
+  int       first;
+  uint32_t  flags;
+  uint32_t  timer;
+  uint64_t  next;
+  uint64_t  ticks;
+  uint32_t *reg;
+
+  next  = TIMER_NONE;
+  first = 1;
+  for(timer = 0; timer < 0x10; timer++)
+    {
+      flags = timer_flags(timer);
+      if(!(flags & DECREMENT))
+        continue;
+
+      reg = timer_regs(timer);
+      if(first || !(flags & CASCADE))
+        ticks = ((uint64_t)reg[0] + 1);
+      else if(reg[0] == 0xFFFFFFFF)
+        ticks = 1;
+      else
+        ticks = TIMER_NONE;
+
+      if(ticks < next)
+        next = ticks;
+      first = 0;
+    }
+
+  return next;
+}
+
+/* ticks_ must end before the next underflow */
+static
+void
+timer_count(const uint64_t ticks_)
+{
+  int      first;
+  uint32_t flags;
+  uint32_t timer;
+
+  first = 1;
+  for(timer = 0; timer < 0x10; timer++)
+    {
+      flags = timer_flags(timer);
+      if(!(flags & DECREMENT))
+        continue;
+
+      if(first || !(flags & CASCADE))
+        timer_regs(timer)[0] -= ticks_;
+      first = 0;
+    }
+}
+
+static
+void
+timer_sync(void)
+{
+  uint64_t now;
+  uint64_t ticks;
+  uint64_t next;
+
+  now   = opera_clock_timer_ticks();
+  ticks = (now - TIMER_SYNC);
+  TIMER_SYNC = now;
+
+  while(ticks)
+    {
+      next = timer_next_underflow();
+      if(next > ticks)
+        {
+          timer_count(ticks);
+          break;
+        }
+
+      timer_count(next - 1);
+      timer_step();
+      ticks -= next;
+    }
+}
+
+static
+void
+timer_schedule(void)
+{
+  uint64_t next;
 
-static uint32_t *MADAM_REGS;
-static clio_t    CLIO;
+  next = timer_next_underflow();
+  opera_clock_timer_schedule((next == TIMER_NONE) ? TIMER_NONE : (TIMER_SYNC + next));
+}
 
 uint32_t
 opera_clio_state_size(void)
@@ -89,6 +292,7 @@ opera_clio_state_size(void)
 void
 opera_clio_state_save(void *buf_)
 {
+  timer_sync();
   memcpy(buf_,&CLIO,sizeof(clio_t));
 }
 
@@ -98,6 +302,10 @@ opera_clio_state_load(const void *buf_)
   TIMER_VAL = 0;
 
   memcpy(&CLIO,buf_,sizeof(clio_t));
+  clio_fiq_update();
+
+  TIMER_SYNC = opera_clock_timer_ticks();
+  timer_schedule();
 }
 
 #define CURADR MADAM_REGS[base+0x00]
@@ -105,57 +313,48 @@ opera_clio_state_load(const void *buf_)
 #define RLDADR MADAM_REGS[base+0x08]
 #define RLDLEN MADAM_REGS[base+0x0C]
 
-void
-opera_clio_timer_set(uint32_t v200_,
-                     uint32_t v208_)
-{
-  (void) v200_;
-  (void) v208_;
-}
-
-void
-opera_clio_timer_clear(uint32_t v204_,
-                       uint32_t v20C_)
-{
-  (void) v204_;
-  (void) v20C_;
-}
-
 uint32_t
 opera_clio_line_vint0(void)
 {
-  return (CLIO.regs[8] & 0x7FF);
+  return (REG(0x08) & 0x7FF);
 }
 
 uint32_t
 opera_clio_line_vint1(void)
 {
-  return (CLIO.regs[12] & 0x7FF);
+  return (REG(0x0C) & 0x7FF);
 }
 
 int
 opera_clio_fiq_needed(void)
 {
-  return ((CLIO.regs[0x40] & CLIO.regs[0x48]) ||
-          (CLIO.regs[0x60] & CLIO.regs[0x68]));
+  return ((REG(0x40) & REG(0x48)) ||
+          (REG(0x60) & REG(0x68)));
 }
 
 void
 opera_clio_fiq_generate(uint32_t reason1_,
                         uint32_t reason2_)
 {
-  CLIO.regs[0x40] |= reason1_;
-  CLIO.regs[0x60] |= reason2_;
+  if(reason1_)
+    OPERA_TRACE_INSTANT("fiq","reason1",reason1_);
+  if(reason2_)
+    OPERA_TRACE_INSTANT("fiq","reason2",reason2_);
+
+  REG(0x40) |= reason1_;
+  REG(0x60) |= reason2_;
   /* irq31 if exist irq32 and high */
-  if(CLIO.regs[0x60])
-    CLIO.regs[0x40] |= 0x80000000;
+  if(REG(0x60))
+    REG(0x40) |= 0x80000000;
+
+  clio_fiq_update();
 }
 
 static
 void
 clio_handle_dma(uint32_t val_)
 {
-  CLIO.regs[0x304] |= val_;
+  REG(0x304) |= val_;
 
   if(val_ & 0x00100000)
     {
@@ -165,10 +364,13 @@ clio_handle_dma(uint32_t val_)
 
       trg = opera_madam_peek(0x540);
       len = opera_madam_peek(0x544);
-      CLIO.regs[0x304] &= ~0x00100000;
-      CLIO.regs[0x400] &= ~0x80;
+      REG(0x304) &= ~0x00100000;
+      REG(0x400) &= ~0x80;
 
-      if(CLIO.regs[0x404] & 0x200)
+      if(len >= 0)
+        OPERA_PERF_COUNT(OPERA_PERF_DMA_BYTES,((len >> 2) + 1) << 2);
+
+      if(REG(0x404) & 0x200)
         {
           while(len >= 0)
             {
@@ -193,7 +395,7 @@ clio_handle_dma(uint32_t val_)
               len -= 4;
             }
 
-          CLIO.regs[0x400] |= 0x80;
+          REG(0x400) |= 0x80;
         }
       else
         {
@@ -220,7 +422,7 @@ clio_handle_dma(uint32_t val_)
               len -= 4;
             }
 
-          CLIO.regs[0x400] |= 0x80;
+          REG(0x400) |= 0x80;
         }
 
       opera_madam_poke(0x544,0xFFFFFFFC);
@@ -243,445 +445,690 @@ if_set_set_reset(uint32_t *output_,
     }
 }
 
-int
-opera_clio_poke(uint32_t addr_,
-                uint32_t val_)
+static
+uint32_t
+clio_peek_none(uint32_t addr_)
 {
-  int base;
-  int i;
+  return 0;
+}
 
-  if(!flagtime)
-    TIMER_VAL = 0;
+static
+uint32_t
+clio_peek_reg(uint32_t addr_)
+{
+  return REG(addr_);
+}
 
-  /* 0x40..0x4C, 0x60..0x6C case */
-  if((addr_ & ~0x2C) == 0x40)
-    {
-      if(addr_ == 0x40)
-        {
-          CLIO.regs[0x40] |= val_;
-          if(CLIO.regs[0x60])
-            CLIO.regs[0x40] |= 0x80000000;
-          /*
-            if(CLIO.regs[0x40]&CLIO.regs[0x48])
-            _arm_SetFIQ();
-          */
-          return 0;
-        }
-      else if(addr_ == 0x44)
-        {
-          CLIO.regs[0x40] &= ~val_;
-          if(!CLIO.regs[0x60])
-            CLIO.regs[0x40] &= ~0x80000000;
-          return 0;
-        }
-      else if(addr_ == 0x48)
-        {
-          CLIO.regs[0x48] |= val_;
-          /*
-            if(CLIO.regs[0x40] & CLIO.regs[0x48])
-            _arm_SetFIQ();
-          */
-          return 0;
-        }
-      else if(addr_ == 0x4C)
-        {
-          /* always one for irq31 */
-          CLIO.regs[0x48] &= ~val_;
-          CLIO.regs[0x48] |= 0x80000000;
-          return 0;
-        }
-#if 0
-      else if(addr_ == 0x50)
-        {
-          CLIO.regs[0x50] |= (val_ & 0x3FFF0000);
-          return 0;
-        }
-      else if(addr_ == 0x54)
-        {
-          CLIO.regs[0x50] &= ~val;
-          return 0;
-        }
-#endif
-      else if(addr_ == 0x60)
-        {
-          CLIO.regs[0x60] |= val_;
-          if(CLIO.regs[0x60])
-            CLIO.regs[0x40] |= 0x80000000;
-          /*
-            if(CLIO.regs[0x60] & CLIO.regs[0x68])
-            _arm_SetFIQ();
-          */
-          return 0;
-        }
-      else if(addr_ == 0x64)
-        {
-          CLIO.regs[0x60] &= ~val_;
-          if(!CLIO.regs[0x60])
-            CLIO.regs[0x40] &= ~0x80000000;
-          return 0;
-        }
-      else if(addr_ == 0x68)
-        {
-          CLIO.regs[0x68] |= val_;
-          /*
-            if(CLIO.regs[0x60] & CLIO.regs[0x68])
-            _arm_SetFIQ();
-          */
-          return 0;
-        }
-      else if(addr_ == 0x6C)
-        {
-          CLIO.regs[0x68] &= ~val_;
-          return 0;
-        }
-    }
-  else if(addr_ == 0x84)
-    {
-      if_set_set_reset(&CLIO.regs[0x84],val_,0x10,0x01);
-      if_set_set_reset(&CLIO.regs[0x84],val_,0x20,0x02);
-      if_set_set_reset(&CLIO.regs[0x84],val_,0x40,0x04);
-      if_set_set_reset(&CLIO.regs[0x84],val_,0x80,0x08);
+static
+uint32_t
+clio_peek_dspp(uint32_t addr_)
+{
+  return DSPP(addr_);
+}
 
-      opera_arm_rom_select(!!(val_ & 0x4));
+static
+uint32_t
+clio_peek_revision(uint32_t addr_)
+{
+  return 0x02020000;
+}
 
-      return 0;
-    }
-  else if(addr_ == 0x0300)
-    {
-      /* clear down the fifos and stop them */
-      base = 0;
-      CLIO.regs[0x304] &= ~val_;
+/* By read 40 and 44, 48 and 4c, 60 and 64, 68 and 6c same */
+static
+uint32_t
+clio_peek_irq0(uint32_t addr_)
+{
+  return REG(0x40);
+}
 
-      for(i = 0; i < 13; i++)
-        {
-          if(val_ & (1 << i))
-            {
-              base = (0x400 + (i << 4));
-              RLDADR = CURADR = 0;
-              RLDLEN = CURLEN = 0;
-              opera_clio_fifo_write(base + 0x00,0);
-              opera_clio_fifo_write(base + 0x04,0);
-              opera_clio_fifo_write(base + 0x08,0);
-              opera_clio_fifo_write(base + 0x0C,0);
-              val_ &= ~(1 << i);
-              CLIO.fifo_i[i].idx = 0;
-            }
-        }
+static
+uint32_t
+clio_peek_mask0(uint32_t addr_)
+{
+  return (REG(0x48) | 0x80000000);
+}
 
-      for(i = 0; i < 4; i++)
-        {
-          if(val_ & (1 << (i + 16)))
-            {
-              base = (0x500 + (i << 4));
-              RLDADR = CURADR = 0;
-              RLDLEN = CURLEN = 0;
-              opera_clio_fifo_write(base + 0x00,0);
-              opera_clio_fifo_write(base + 0x04,0);
-              opera_clio_fifo_write(base + 0x08,0);
-              opera_clio_fifo_write(base + 0x0C,0);
-              val_ &= ~(1 << (i + 16));
-              CLIO.fifo_o[i].idx = 0;
-            }
-        }
+static
+uint32_t
+clio_peek_irq1(uint32_t addr_)
+{
+  return REG(0x60);
+}
 
-      return 0;
-    }
-  else if(addr_ == 0x304) /* DMA starter */
-    {
-      clio_handle_dma(val_);
-      switch(val_)
-        {
-        case 0x100000:
-          if(TIMER_VAL < 5800)
-            TIMER_VAL += 0x33;
-          flagtime = (opera_clock_cpu_get_freq() / 2000000);
-          break;
-        default:
-          if(!CLIO.regs[0x304])
-            TIMER_VAL = 0;
-          break;
-        }
-      return 0;
-    }
-  else if(addr_ == 0x308) /* DMA stopper */
-    {
-      CLIO.regs[0x304] &= ~val_;
-      return 0;
-    }
-  else if(addr_ == 0x400) /* XBUS direction */
-    {
-      if(val_ & 0x800)
-        return 0;
+static
+uint32_t
+clio_peek_mask1(uint32_t addr_)
+{
+  return REG(0x68);
+}
 
-      CLIO.regs[0x400] = val_;
-      return 0;
-    }
-  else if((addr_ >= 0x500) && (addr_ < 0x540))
-    {
-      opera_xbus_set_sel(val_);
-      return 0;
-    }
-  else if((addr_ >= 0x540) && (addr_ < 0x580))
-    {
-      opera_xbus_set_poll(val_);
-      return 0;
-    }
-  else if((addr_ >= 0x580) && (addr_ < 0x5C0))
-    {
-      /* on FIFO Filled execute the command */
-      opera_xbus_fifo_set_cmd(val_);
-      return 0;
-    }
-  else if((addr_ >= 0x5c0) && (addr_ < 0x600))
-    {
-      /* on FIFO Filled execute the command */
-      opera_xbus_fifo_set_data(val_);
-      return 0;
-    }
-  else if(addr_ == 0x28)
-    {
-      CLIO.regs[addr_] = val_;
-      return (val_ == 0x30);
-    }
-  else if((addr_ >= 0x1800) && (addr_ <= 0x1FFF))
-    {
-      addr_ &= ~0x400; /* mirrors */
-      CLIO.dsp_word1   = (val_ >> 16);
-      CLIO.dsp_word2   = (val_ & 0xFFFF);
-      CLIO.dsp_address = ((addr_ - 0x1800) >> 1);
-      opera_dsp_mem_write(CLIO.dsp_address+0,CLIO.dsp_word1);
-      opera_dsp_mem_write(CLIO.dsp_address+1,CLIO.dsp_word2);
-      return 0;
-      /* DSPNRAMWrite 2 DSPW per 1ARMW */
-    }
-  else if((addr_ >= 0x2000) && (addr_ <= 0x2FFF))
-    {
-      addr_ &= ~0x800; /* mirrors */
-      CLIO.dsp_word1   = (val_ & 0xFFFF);
-      CLIO.dsp_address = ((addr_ - 0x2000) >> 2);
-      opera_dsp_mem_write(CLIO.dsp_address,CLIO.dsp_word1);
-      return 0;
-    }
-  else if((addr_ >= 0x3000) && (addr_ <= 0x33FF))
-    {
-      CLIO.dsp_address  = ((addr_ - 0x3000) >> 1);
-      CLIO.dsp_address &= 0xFF;
-      CLIO.dsp_word1    = (val_ >> 16);
-      CLIO.dsp_word2    = (val_ & 0xFFFF);
-      opera_dsp_imem_write(CLIO.dsp_address+0,CLIO.dsp_word1);
-      opera_dsp_imem_write(CLIO.dsp_address+1,CLIO.dsp_word2);
-      return 0;
-    }
-  else if((addr_ >= 0x3400) && (addr_ <= 0x37FF))
-    {
-      CLIO.dsp_address  = ((addr_ - 0x3400) >> 2);
-      CLIO.dsp_address &= 0xFF;
-      CLIO.dsp_word1    = (val_ & 0xFFFF);
-      opera_dsp_imem_write(CLIO.dsp_address,CLIO.dsp_word1);
-      return 0;
-    }
-  else if(addr_ == 0x17E8) /* Reset */
-    {
-      opera_dsp_reset();
-      return 0;
-    }
-  else if(addr_ == 0x17D0) /* Write DSP/ARM Semaphore */
-    {
-      opera_dsp_arm_semaphore_write(val_);
-      return 0;
-    }
-  else if(addr_ == 0x17FC) /* start / stop */
-    {
-      opera_dsp_set_running(val_ > 0);
-      return 0;
-    }
-  else if(addr_ == 0x200)
-    {
-      CLIO.regs[0x200] |= val_;
-      opera_clio_timer_set(val_,0);
-      return 0;
-    }
-  else if(addr_ == 0x204)
-    {
-      CLIO.regs[0x200] &= ~val_;
-      opera_clio_timer_clear(val_,0);
-      return 0;
-    }
-  else if(addr_ == 0x208)
-    {
-      CLIO.regs[0x208] |= val_;
-      opera_clio_timer_set(0,val_);
-      return 0;
-    }
-  else if(addr_ == 0x20C)
-    {
-      CLIO.regs[0x208] &= ~val_;
-      opera_clio_timer_clear(0,val_);
-      return 0;
-    }
-  else if(addr_ == 0x220)
-    {
-      CLIO.regs[addr_] = (val_ & 0x3FF);
-      opera_clock_timer_set_delay(CLIO.regs[addr_]);
-      return 0;
-    }
-  else if(addr_ == 0x120)
+/* counters are only current after a sync, reload values always are */
+static
+uint32_t
+clio_peek_timer(uint32_t addr_)
+{
+  if(!(addr_ & 0x4))
+    timer_sync();
+
+  return REG(addr_);
+}
+
+static
+uint32_t
+clio_peek_timer0(uint32_t addr_)
+{
+  return REG(0x200);
+}
+
+static
+uint32_t
+clio_peek_timer1(uint32_t addr_)
+{
+  return REG(0x208);
+}
+
+static
+uint32_t
+clio_peek_dma(uint32_t addr_)
+{
+  return REG(0x304);
+}
+
+static
+uint32_t
+clio_peek_xbus_0x414(uint32_t addr_)
+{
+  return 0x4000; /* TO CHECK!!! requested by CDROMDIPIR */
+}
+
+static
+uint32_t
+clio_peek_xbus_res(uint32_t addr_)
+{
+  return opera_xbus_get_res();
+}
+
+static
+uint32_t
+clio_peek_xbus_poll(uint32_t addr_)
+{
+  return opera_xbus_get_poll();
+}
+
+static
+uint32_t
+clio_peek_xbus_status(uint32_t addr_)
+{
+  return opera_xbus_fifo_get_status();
+}
+
+static
+uint32_t
+clio_peek_xbus_data(uint32_t addr_)
+{
+  return opera_xbus_fifo_get_data();
+}
+
+static
+uint32_t
+clio_peek_sema4(uint32_t addr_)
+{
+  /* read DSP/ARM semaphore */
+  return opera_dsp_arm_semaphore_read();
+}
+
+static
+uint32_t
+clio_peek_noise(uint32_t addr_)
+{
+  return fastrand();
+}
+
+/* 2DSPW per 1ARMW */
+static
+uint32_t
+clio_peek_imem2(uint32_t addr_)
+{
+  CLIO.dsp_address  = ((addr_ - 0x3800) >> 1);
+  CLIO.dsp_address &= 0xFF;
+  CLIO.dsp_address += 0x300;
+  CLIO.dsp_word1    = opera_dsp_imem_read(CLIO.dsp_address+0);
+  CLIO.dsp_word2    = opera_dsp_imem_read(CLIO.dsp_address+1);
+  return ((CLIO.dsp_word1 << 16) | CLIO.dsp_word2);
+}
+
+static
+uint32_t
+clio_peek_imem1(uint32_t addr_)
+{
+  CLIO.dsp_address  = ((addr_ - 0x3C00) >> 2);
+  CLIO.dsp_address &= 0xFF;
+  CLIO.dsp_address += 0x300;
+  return opera_dsp_imem_read(CLIO.dsp_address);
+}
+
+static
+int
+clio_poke_none(uint32_t addr_,
+               uint32_t val_)
+{
+  return 0;
+}
+
+static
+int
+clio_poke_reg(uint32_t addr_,
+              uint32_t val_)
+{
+  REG(addr_) = val_;
+  return 0;
+}
+
+static
+int
+clio_poke_dspp(uint32_t addr_,
+               uint32_t val_)
+{
+  DSPP(addr_) = val_;
+  return 0;
+}
+
+static
+int
+clio_poke_cstatbits(uint32_t addr_,
+                    uint32_t val_)
+{
+  REG(0x28) = val_;
+  return (val_ == 0x30);
+}
+
+static
+int
+clio_poke_irq0_set(uint32_t addr_,
+                   uint32_t val_)
+{
+  REG(0x40) |= val_;
+  if(REG(0x60))
+    REG(0x40) |= 0x80000000;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_irq0_clr(uint32_t addr_,
+                   uint32_t val_)
+{
+  REG(0x40) &= ~val_;
+  if(!REG(0x60))
+    REG(0x40) &= ~0x80000000;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_mask0_set(uint32_t addr_,
+                    uint32_t val_)
+{
+  REG(0x48) |= val_;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_mask0_clr(uint32_t addr_,
+                    uint32_t val_)
+{
+  /* always one for irq31 */
+  REG(0x48) &= ~val_;
+  REG(0x48) |= 0x80000000;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_irq1_set(uint32_t addr_,
+                   uint32_t val_)
+{
+  REG(0x60) |= val_;
+  if(REG(0x60))
+    REG(0x40) |= 0x80000000;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_irq1_clr(uint32_t addr_,
+                   uint32_t val_)
+{
+  REG(0x60) &= ~val_;
+  if(!REG(0x60))
+    REG(0x40) &= ~0x80000000;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_mask1_set(uint32_t addr_,
+                    uint32_t val_)
+{
+  REG(0x68) |= val_;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_mask1_clr(uint32_t addr_,
+                    uint32_t val_)
+{
+  REG(0x68) &= ~val_;
+  clio_fiq_update();
+  return 0;
+}
+
+static
+int
+clio_poke_adbio(uint32_t addr_,
+                uint32_t val_)
+{
+  if_set_set_reset(&REG(0x84),val_,0x10,0x01);
+  if_set_set_reset(&REG(0x84),val_,0x20,0x02);
+  if_set_set_reset(&REG(0x84),val_,0x40,0x04);
+  if_set_set_reset(&REG(0x84),val_,0x80,0x08);
+
+  opera_arm_rom_select(!!(val_ & 0x4));
+
+  return 0;
+}
+
+static
+int
+clio_poke_timer(uint32_t addr_,
+                uint32_t val_)
+{
+  if(addr_ & 0x4)
     {
-      /* 316 or 800? */
-      CLIO.regs[addr_] = ((TIMER_VAL > 800) ?
-                          (TIMER_VAL+(val_/0x30)) : val_);
+      REG(addr_) = val_;
       return 0;
     }
 
-  CLIO.regs[addr_] = val_;
+  timer_sync();
+  REG(addr_) = val_;
+  timer_schedule();
+  return 0;
+}
+
+static
+int
+clio_poke_timer4(uint32_t addr_,
+                 uint32_t val_)
+{
+  timer_sync();
+  /* 316 or 800? */
+  REG(0x120) = ((TIMER_VAL > 800) ?
+                (TIMER_VAL+(val_/0x30)) : val_);
+  timer_schedule();
+  return 0;
+}
 
+static
+int
+clio_poke_timer_set0(uint32_t addr_,
+                     uint32_t val_)
+{
+  timer_sync();
+  REG(0x200) |= val_;
+  timer_schedule();
   return 0;
 }
 
-uint32_t
-opera_clio_peek(uint32_t addr_)
+static
+int
+clio_poke_timer_clr0(uint32_t addr_,
+                     uint32_t val_)
+{
+  timer_sync();
+  REG(0x200) &= ~val_;
+  timer_schedule();
+  return 0;
+}
+
+static
+int
+clio_poke_timer_set1(uint32_t addr_,
+                     uint32_t val_)
+{
+  timer_sync();
+  REG(0x208) |= val_;
+  timer_schedule();
+  return 0;
+}
+
+static
+int
+clio_poke_timer_clr1(uint32_t addr_,
+                     uint32_t val_)
+{
+  timer_sync();
+  REG(0x208) &= ~val_;
+  timer_schedule();
+  return 0;
+}
+
+static
+int
+clio_poke_slack(uint32_t addr_,
+                uint32_t val_)
+{
+  REG(0x220) = (val_ & 0x3FF);
+  opera_clock_timer_set_delay(REG(0x220));
+  return 0;
+}
+
+static
+int
+clio_poke_fifo_stop(uint32_t addr_,
+                    uint32_t val_)
 {
-  /* 0x40..0x4C, 0x60..0x6C case */
-  if((addr_ & ~0x2C) == 0x40)
+  int i;
+  int base;
+
+  /* clear down the fifos and stop them */
+  base = 0;
+  REG(0x304) &= ~val_;
+
+  for(i = 0; i < 13; i++)
     {
-      /* By read 40 and 44, 48 and 4c, 60 and 64, 68 and 6c same */
-      addr_ &= ~4;
-      if(addr_ == 0x40)
-        return CLIO.regs[0x40];
-      else if(addr_ == 0x48)
-        return (CLIO.regs[0x48] | 0x80000000);
-      else if(addr_ == 0x60)
-        return CLIO.regs[0x60];
-      else if(addr_ == 0x68)
-        return CLIO.regs[0x68];
-      return 0;
+      if(val_ & (1 << i))
+        {
+          base = (0x400 + (i << 4));
+          RLDADR = CURADR = 0;
+          RLDLEN = CURLEN = 0;
+          opera_clio_fifo_write(base + 0x00,0);
+          opera_clio_fifo_write(base + 0x04,0);
+          opera_clio_fifo_write(base + 0x08,0);
+          opera_clio_fifo_write(base + 0x0C,0);
+          val_ &= ~(1 << i);
+          CLIO.fifo_i[i].idx = 0;
+        }
     }
-  else if(addr_ == 0x204)
-    return CLIO.regs[0x200];
-  else if(addr_ == 0x20C)
-    return CLIO.regs[0x208];
-  else if(addr_ == 0x308)
-    return CLIO.regs[0x304];
-  else if (addr_ == 0x414)
-    return 0x4000; /* TO CHECK!!! requested by CDROMDIPIR */
-  else if((addr_ >= 0x500) && (addr_ < 0x540))
-    return opera_xbus_get_res();
-  else if((addr_ >= 0x540) && (addr_ < 0x580))
-    return opera_xbus_get_poll();
-  else if((addr_ >= 0x580) && (addr_ < 0x5C0))
-    return opera_xbus_fifo_get_status();
-  else if((addr_ >= 0x5C0) && (addr_ < 0x600))
-    return opera_xbus_fifo_get_data();
-  else if(addr_ == 0x0)
-    return 0x02020000;
-  else if((addr_ >= 0x3800) && (addr_ <= 0x3BFF))
+
+  for(i = 0; i < 4; i++)
     {
-      /* 2DSPW per 1ARMW */
-      CLIO.dsp_address  = ((addr_ - 0x3800) >> 1);
-      CLIO.dsp_address &= 0xFF;
-      CLIO.dsp_address += 0x300;
-      CLIO.dsp_word1    = opera_dsp_imem_read(CLIO.dsp_address+0);
-      CLIO.dsp_word2    = opera_dsp_imem_read(CLIO.dsp_address+1);
-      return ((CLIO.dsp_word1 << 16) | CLIO.dsp_word2);
+      if(val_ & (1 << (i + 16)))
+        {
+          base = (0x500 + (i << 4));
+          RLDADR = CURADR = 0;
+          RLDLEN = CURLEN = 0;
+          opera_clio_fifo_write(base + 0x00,0);
+          opera_clio_fifo_write(base + 0x04,0);
+          opera_clio_fifo_write(base + 0x08,0);
+          opera_clio_fifo_write(base + 0x0C,0);
+          val_ &= ~(1 << (i + 16));
+          CLIO.fifo_o[i].idx = 0;
+        }
     }
-  else if((addr_ >= 0x3C00) && (addr_ <= 0x3FFF))
+
+  return 0;
+}
+
+static
+int
+clio_poke_dma_start(uint32_t addr_,
+                    uint32_t val_)
+{
+  OPERA_TRACE_BEGIN("dma");
+  OPERA_PERF_BEGIN(OPERA_PERF_DMA);
+  clio_handle_dma(val_);
+  OPERA_PERF_END(OPERA_PERF_DMA);
+  OPERA_TRACE_END_ARG("dma","mask",val_);
+  switch(val_)
     {
-      CLIO.dsp_address  = ((addr_ - 0x3C00) >> 2);
-      CLIO.dsp_address &= 0xFF;
-      CLIO.dsp_address += 0x300;
-      return opera_dsp_imem_read(CLIO.dsp_address);
+    case 0x100000:
+      if(TIMER_VAL < 5800)
+        TIMER_VAL += 0x33;
+      flagtime = (opera_clock_cpu_get_freq() / 2000000);
+      break;
+    default:
+      if(!REG(0x304))
+        TIMER_VAL = 0;
+      break;
     }
-  else if(addr_ == 0x17F0)
-    return fastrand();
-  else if(addr_ == 0x17D0) /* read DSP/ARM semaphore */
-    return opera_dsp_arm_semaphore_read();
 
-  return CLIO.regs[addr_];
+  return 0;
+}
+
+static
+int
+clio_poke_dma_stop(uint32_t addr_,
+                   uint32_t val_)
+{
+  REG(0x304) &= ~val_;
+  return 0;
 }
 
-void
-opera_clio_vcnt_update(int line_,
-                       int field_)
+static
+int
+clio_poke_xbus_dir(uint32_t addr_,
+                   uint32_t val_)
 {
-  CLIO.regs[0x34] = ((field_ << 11) + line_);
+  if(val_ & 0x800)
+    return 0;
+
+  REG(0x400) = val_;
+  return 0;
 }
 
 static
-uint32_t
-timer_flags(const uint32_t timer_)
+int
+clio_poke_xbus_sel(uint32_t addr_,
+                   uint32_t val_)
+{
+  opera_xbus_set_sel(val_);
+  return 0;
+}
+
+static
+int
+clio_poke_xbus_poll(uint32_t addr_,
+                    uint32_t val_)
+{
+  opera_xbus_set_poll(val_);
+  return 0;
+}
+
+/* on FIFO Filled execute the command */
+static
+int
+clio_poke_xbus_cmd(uint32_t addr_,
+                   uint32_t val_)
+{
+  opera_xbus_fifo_set_cmd(val_);
+  return 0;
+}
+
+static
+int
+clio_poke_xbus_data(uint32_t addr_,
+                    uint32_t val_)
+{
+  opera_xbus_fifo_set_data(val_);
+  return 0;
+}
+
+/* Write DSP/ARM Semaphore */
+static
+int
+clio_poke_sema4(uint32_t addr_,
+                uint32_t val_)
+{
+  opera_dsp_arm_semaphore_write(val_);
+  return 0;
+}
+
+static
+int
+clio_poke_dsp_reset(uint32_t addr_,
+                    uint32_t val_)
+{
+  opera_dsp_reset();
+  return 0;
+}
+
+/* start / stop */
+static
+int
+clio_poke_dsp_run(uint32_t addr_,
+                  uint32_t val_)
+{
+  opera_dsp_set_running(val_ > 0);
+  return 0;
+}
+
+/* DSPNRAMWrite 2 DSPW per 1ARMW */
+static
+int
+clio_poke_nmem2(uint32_t addr_,
+                uint32_t val_)
+{
+  addr_ &= ~0x400; /* mirrors */
+  CLIO.dsp_word1   = (val_ >> 16);
+  CLIO.dsp_word2   = (val_ & 0xFFFF);
+  CLIO.dsp_address = ((addr_ - 0x1800) >> 1);
+  opera_dsp_mem_write(CLIO.dsp_address+0,CLIO.dsp_word1);
+  opera_dsp_mem_write(CLIO.dsp_address+1,CLIO.dsp_word2);
+  return 0;
+}
+
+static
+int
+clio_poke_nmem1(uint32_t addr_,
+                uint32_t val_)
 {
-  return ((CLIO.regs[((timer_ < 8) ? 0x200 : 0x208)] >> ((timer_ << 2) & 0x1F)) & 0xF);
+  addr_ &= ~0x800; /* mirrors */
+  CLIO.dsp_word1   = (val_ & 0xFFFF);
+  CLIO.dsp_address = ((addr_ - 0x2000) >> 2);
+  opera_dsp_mem_write(CLIO.dsp_address,CLIO.dsp_word1);
+  return 0;
 }
 
 static
+int
+clio_poke_imem2(uint32_t addr_,
+                uint32_t val_)
+{
+  CLIO.dsp_address  = ((addr_ - 0x3000) >> 1);
+  CLIO.dsp_address &= 0xFF;
+  CLIO.dsp_word1    = (val_ >> 16);
+  CLIO.dsp_word2    = (val_ & 0xFFFF);
+  opera_dsp_imem_write(CLIO.dsp_address+0,CLIO.dsp_word1);
+  opera_dsp_imem_write(CLIO.dsp_address+1,CLIO.dsp_word2);
+  return 0;
+}
+
+static
+int
+clio_poke_imem1(uint32_t addr_,
+                uint32_t val_)
+{
+  CLIO.dsp_address  = ((addr_ - 0x3400) >> 2);
+  CLIO.dsp_address &= 0xFF;
+  CLIO.dsp_word1    = (val_ & 0xFFFF);
+  opera_dsp_imem_write(CLIO.dsp_address,CLIO.dsp_word1);
+  return 0;
+}
+
+/* CLIO_IO: see tools/opera_gentables.c */
+#include "opera_clio_tables_i.h"
+
+#define CLIO_PEEK_HANDLER(FIRST,LAST,PEEK,POKE) clio_peek_##PEEK,
+#define CLIO_POKE_HANDLER(FIRST,LAST,PEEK,POKE) clio_poke_##POKE,
+
+static const clio_peek_t CLIO_PEEK[] =
+  {
+    clio_peek_none,
+    CLIO_REGS(CLIO_PEEK_HANDLER)
+  };
+
+static const clio_poke_t CLIO_POKE[] =
+  {
+    clio_poke_none,
+    CLIO_REGS(CLIO_POKE_HANDLER)
+  };
+
+int
+opera_clio_poke(uint32_t addr_,
+                uint32_t val_)
+{
+  if(!flagtime)
+    TIMER_VAL = 0;
+
+  return CLIO_POKE[CLIO_IO[(addr_ >> 2) & 0x3FFF]](addr_,val_);
+}
+
+uint32_t
+opera_clio_peek(uint32_t addr_)
+{
+  if(addr_ & ~0xFFFF)
+    return 0;
+
+  return CLIO_PEEK[CLIO_IO[addr_ >> 2]](addr_);
+}
+
 void
-timer_disable(const uint32_t timer_)
+opera_clio_vcnt_update(int line_,
+                       int field_)
 {
-  CLIO.regs[((timer_ < 8) ? 0x200 : 0x208)] &= ~(DECREMENT << ((timer_ << 2)));
+  REG(0x34) = ((field_ << 11) + line_);
 }
 
+/* called on the clock tick of the next underflow */
 void
 opera_clio_timer_execute(void)
 {
-  uint32_t *reg;
-  uint32_t  flags;
-  uint32_t  timer;
-  uint32_t  carry;
-
-  carry = 1;
-  for(timer = 0; timer < 0x10; timer++)
-    {
-      flags = timer_flags(timer);
-      if(!(flags & DECREMENT))
-        continue;
-
-      reg = &CLIO.regs[(0x100 + (timer << 3))];
-      reg[0] -= ((flags & CASCADE) ? carry : 1);
-      if(reg[0] == 0xFFFFFFFF)
-        {
-          carry = 1;
-          if(timer & 1)
-            opera_clio_fiq_generate(1<<(10-(timer>>1)),0);
-          if(flags & RELOAD)
-            reg[0] = reg[4];
-          else
-            timer_disable(timer);
-        }
-      else
-        {
-          carry = 0;
-        }
-    }
+  timer_sync();
+  timer_schedule();
 }
 
 uint32_t
 opera_clio_timer_get_delay(void)
 {
-  return CLIO.regs[0x220];
+  return REG(0x220);
 }
 
 void opera_clio_init(int reason_)
 {
-  unsigned i;
-  for(i = 0; i < 32768; i++)
-    CLIO.regs[i] = 0;
+  memset(CLIO.regs,0,sizeof(CLIO.regs));
+  memset(CLIO.dspp,0,sizeof(CLIO.dspp));
 
-  //CLIO.regs[8]=240;
+  //REG(0x08)=240;
 
-  CLIO.regs[0x0028] = reason_;
-  CLIO.regs[0x0400] = 0x80;
-  CLIO.regs[0x0220] = 64;
+  REG(0x0028) = reason_;
+  REG(0x0400) = 0x80;
+  REG(0x0220) = 64;
   MADAM_REGS = opera_madam_registers();
   TIMER_VAL  = 0;
+  TIMER_SYNC = opera_clock_timer_ticks();
+
+  clio_fiq_update();
+  timer_schedule();
 }
 
 void
 opera_clio_reset(void)
 {
-  int i;
+  memset(CLIO.regs,0,sizeof(CLIO.regs));
+  memset(CLIO.dspp,0,sizeof(CLIO.dspp));
+  TIMER_SYNC = opera_clock_timer_ticks();
 
-  for(i = 0;i < 65536; i++)
-    CLIO.regs[i] = 0;
+  clio_fiq_update();
+  timer_schedule();
 }
 
 uint16_t
@@ -0,0 +1,56 @@
+#ifndef LIBOPERA_CLIO_REGS_I_H_INCLUDED
+#define LIBOPERA_CLIO_REGS_I_H_INCLUDED
+
+/*
+  CLIO register description. Each entry is an inclusive byte address
+  range and the peek and poke handlers for the words in it. Later
+  entries override earlier ones and addresses not covered by any entry
+  read as zero and ignore writes. 'reg' and 'dspp' are plain storage
+  in the dense register file, 'none' has no storage.
+
+  tools/opera-gentables turns this into the per word handler index in
+  opera_clio_tables_i.h. Run `make opera-tables` after editing it.
+*/
+
+#define CLIO_REGS(X)                            \
+  X(0x0000,0x05FC,reg,reg)                      \
+  X(0x0000,0x0000,revision,reg)                 \
+  X(0x0028,0x0028,reg,cstatbits)                \
+  X(0x0040,0x0040,irq0,irq0_set)                \
+  X(0x0044,0x0044,irq0,irq0_clr)                \
+  X(0x0048,0x0048,mask0,mask0_set)              \
+  X(0x004C,0x004C,mask0,mask0_clr)              \
+  X(0x0060,0x0060,irq1,irq1_set)                \
+  X(0x0064,0x0064,irq1,irq1_clr)                \
+  X(0x0068,0x0068,mask1,mask1_set)              \
+  X(0x006C,0x006C,mask1,mask1_clr)              \
+  X(0x0084,0x0084,reg,adbio)                    \
+  X(0x0100,0x017C,timer,timer)                  \
+  X(0x0120,0x0120,timer,timer4)                 \
+  X(0x0200,0x0200,reg,timer_set0)               \
+  X(0x0204,0x0204,timer0,timer_clr0)            \
+  X(0x0208,0x0208,reg,timer_set1)               \
+  X(0x020C,0x020C,timer1,timer_clr1)            \
+  X(0x0220,0x0220,reg,slack)                    \
+  X(0x0300,0x0300,reg,fifo_stop)                \
+  X(0x0304,0x0304,reg,dma_start)                \
+  X(0x0308,0x0308,dma,dma_stop)                 \
+  X(0x0400,0x0400,reg,xbus_dir)                 \
+  X(0x0414,0x0414,xbus_0x414,reg)               \
+  X(0x0500,0x053C,xbus_res,xbus_sel)            \
+  X(0x0540,0x057C,xbus_poll,xbus_poll)          \
+  X(0x0580,0x05BC,xbus_status,xbus_cmd)         \
+  X(0x05C0,0x05FC,xbus_data,xbus_data)          \
+  X(0x1700,0x17FC,dspp,dspp)                    \
+  X(0x17D0,0x17D0,sema4,sema4)                  \
+  X(0x17E8,0x17E8,dspp,dsp_reset)               \
+  X(0x17F0,0x17F0,noise,dspp)                   \
+  X(0x17FC,0x17FC,dspp,dsp_run)                 \
+  X(0x1800,0x1FFC,none,nmem2)                   \
+  X(0x2000,0x2FFC,none,nmem1)                   \
+  X(0x3000,0x33FC,none,imem2)                   \
+  X(0x3400,0x37FC,none,imem1)                   \
+  X(0x3800,0x3BFC,imem2,none)                   \
+  X(0x3C00,0x3FFC,imem1,none)
+
+#endif /* LIBOPERA_CLIO_REGS_I_H_INCLUDED */
@@ -2,6 +2,9 @@
 #include "opera_clock.h"
 #include "opera_core.h"
 #include "opera_vdlp.h"
+#include "thread_local.h"
+
+#include <string.h>
 
 #define DEFAULT_CPU_FREQ     12500000UL
 #define MIN_CPU_FREQ         1000000UL
@@ -24,9 +27,11 @@ struct opera_clock_s
   int32_t  cycles_per_snd;
   int32_t  cycles_per_scanline;
   int32_t  cycles_per_timer;
+  uint64_t timer_ticks;
+  uint64_t timer_event;
 };
 
-static opera_clock_t g_CLOCK;
+static THREAD_LOCAL opera_clock_t g_CLOCK;
 
 
 static
@@ -117,7 +122,23 @@ opera_clock_cpu_get_default_freq(void)
   return DEFAULT_CPU_FREQ;
 }
 
-/* Unnecessary. For backwards compatibility. */
+/*
+  Only the accumulators and the timer tick count are state, the rest
+  follows from the settings. The block keeps its original size and is
+  tagged so states saved while it was unused leave the clock alone.
+*/
+#define CLOCK_STATE_TAG 0x434C4B31
+
+typedef struct opera_clock_state_s opera_clock_state_t;
+struct opera_clock_state_s
+{
+  uint32_t tag;
+  int32_t  dsp_acc;
+  int32_t  vdl_acc;
+  int32_t  timer_acc;
+  uint64_t timer_ticks;
+};
+
 uint32_t
 opera_clock_state_size(void)
 {
@@ -127,13 +148,32 @@ opera_clock_state_size(void)
 void
 opera_clock_state_save(void *buf_)
 {
-  /* memcpy(buf_,&g_CLOCK,sizeof(opera_clock_t)); */
+  opera_clock_state_t state;
+
+  memset(buf_,0,opera_clock_state_size());
+
+  state.tag         = CLOCK_STATE_TAG;
+  state.dsp_acc     = g_CLOCK.dsp_acc;
+  state.vdl_acc     = g_CLOCK.vdl_acc;
+  state.timer_acc   = g_CLOCK.timer_acc;
+  state.timer_ticks = g_CLOCK.timer_ticks;
+
+  memcpy(buf_,&state,sizeof(state));
 }
 
 void
 opera_clock_state_load(const void *buf_)
 {
-  /* memcpy(&g_CLOCK,buf_,sizeof(opera_clock_t)); */
+  opera_clock_state_t state;
+
+  memcpy(&state,buf_,sizeof(state));
+  if(state.tag != CLOCK_STATE_TAG)
+    return;
+
+  g_CLOCK.dsp_acc     = state.dsp_acc;
+  g_CLOCK.vdl_acc     = state.vdl_acc;
+  g_CLOCK.timer_acc   = state.timer_acc;
+  g_CLOCK.timer_ticks = state.timer_ticks;
 }
 
 void
@@ -144,6 +184,8 @@ opera_clock_init(void)
   g_CLOCK.vdl_acc     = 0;
   g_CLOCK.timer_acc   = 0;
   g_CLOCK.timer_delay = 0x150;  /* same as the OS will set */
+  g_CLOCK.timer_ticks = 0;
+  g_CLOCK.timer_event = UINT64_MAX;
   g_CLOCK.field_size  = NTSC_FIELD_SIZE;
   g_CLOCK.field_rate  = NTSC_FIELD_RATE_1616;
 
@@ -174,18 +216,37 @@ opera_clock_dsp_queued(void)
   return 0;
 }
 
+/*
+  Timer ticks are only counted here. CLIO works out its counters from
+  the tick count when they're accessed and schedules the tick of the
+  next underflow, which is the only time this reports the timers due.
+*/
 int
 opera_clock_timer_queued(void)
 {
   if(g_CLOCK.timer_acc >= g_CLOCK.cycles_per_timer)
     {
       g_CLOCK.timer_acc -= g_CLOCK.cycles_per_timer;
-      return 1;
+      g_CLOCK.timer_ticks++;
+      return (g_CLOCK.timer_ticks >= g_CLOCK.timer_event);
     }
 
   return 0;
 }
 
+uint64_t
+opera_clock_timer_ticks(void)
+{
+  return g_CLOCK.timer_ticks;
+}
+
+/* UINT64_MAX when no timer is counting */
+void
+opera_clock_timer_schedule(const uint64_t tick_)
+{
+  g_CLOCK.timer_event = tick_;
+}
+
 void
 opera_clock_push_cycles(const uint32_t clks_)
 {
@@ -12,6 +12,8 @@ void     opera_clock_init(void);
 int      opera_clock_vdl_queued(void);
 int      opera_clock_dsp_queued(void);
 int      opera_clock_timer_queued(void);
+uint64_t opera_clock_timer_ticks(void);
+void     opera_clock_timer_schedule(const uint64_t tick);
 
 void     opera_clock_push_cycles(const uint32_t clks);
 
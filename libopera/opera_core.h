@@ -25,6 +25,7 @@
 #define LIBOPERA_CORE_H_INCLUDED
 
 #include "extern_c.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 
@@ -34,9 +35,9 @@ typedef void* (*opera_ext_interface_t)(int, void*);
 
 EXTERN_C_BEGIN
 
-extern int      HIRESMODE;
-extern int      CNBFIX;
-extern uint32_t FIXMODE;
+extern THREAD_LOCAL int      HIRESMODE;
+extern THREAD_LOCAL int      CNBFIX;
+extern THREAD_LOCAL uint32_t FIXMODE;
 
 EXTERN_C_END
 
@@ -0,0 +1,767 @@
+#include "endianness.h"
+#include "opera_cpu.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_X86
+#include <immintrin.h>
+#define CPU_TARGET(X) __attribute__((target(X)))
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CPU_NEON
+#include <arm_neon.h>
+#endif
+
+/* scalar */
+
+static
+void
+cpu_fill32_c(uint32_t       *dst_,
+             const uint32_t  val_,
+             const uint32_t  count_)
+{
+  uint32_t i;
+
+  for(i = 0; i < count_; i++)
+    dst_[i] = val_;
+}
+
+static
+void
+cpu_fill32_mask_c(uint32_t       *dst_,
+                  const uint32_t  val_,
+                  const uint32_t  mask_,
+                  const uint32_t  count_)
+{
+  uint32_t i;
+
+  for(i = 0; i < count_; i++)
+    dst_[i] = (((dst_[i] ^ val_) & mask_) ^ val_);
+}
+
+static
+void
+cpu_copy32_mask_c(uint32_t       *dst_,
+                  const uint32_t *src_,
+                  const uint32_t  mask_,
+                  const uint32_t  count_)
+{
+  uint32_t i;
+
+  for(i = 0; i < count_; i++)
+    dst_[i] = (((dst_[i] ^ src_[i]) & mask_) ^ src_[i]);
+}
+
+static
+void
+cpu_bswap32_c(uint32_t       *buf_,
+              const uint32_t  count_)
+{
+  uint32_t i;
+
+  for(i = 0; i < count_; i++)
+    buf_[i] = SWAP32(buf_[i]);
+}
+
+static
+void
+cpu_vdlp_0rgb1555_c(uint16_t       *dst_,
+                    const uint32_t *src_,
+                    const uint32_t  count_)
+{
+  uint32_t i;
+  uint16_t p;
+
+  for(i = 0; i < count_; i++)
+    {
+      p = *(const uint16_t*)&src_[i];
+      dst_[i] = (p & 0x7FFF);
+    }
+}
+
+static
+void
+cpu_vdlp_rgb565_c(uint16_t       *dst_,
+                  const uint32_t *src_,
+                  const uint32_t  count_)
+{
+  uint32_t i;
+  uint16_t p;
+
+  for(i = 0; i < count_; i++)
+    {
+      p = *(const uint16_t*)&src_[i];
+      dst_[i] = (((p & 0x7FE0) << 1) | (p & 0x001F));
+    }
+}
+
+static
+void
+cpu_vdlp_xrgb8888_c(uint32_t       *dst_,
+                    const uint32_t *src_,
+                    const uint32_t  count_)
+{
+  uint32_t i;
+  uint32_t p;
+
+  for(i = 0; i < count_; i++)
+    {
+      p = *(const uint16_t*)&src_[i];
+      dst_[i] = (((p & 0x7C00) << 0x9) |
+                 ((p & 0x03E0) << 0x6) |
+                 ((p & 0x001F) << 0x3));
+    }
+}
+
+#ifdef CPU_X86
+
+/* SSE2 */
+
+static
+CPU_TARGET("sse2")
+void
+cpu_fill32_sse2(uint32_t       *dst_,
+                const uint32_t  val_,
+                const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i v;
+
+  v = _mm_set1_epi32(val_);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    _mm_storeu_si128((__m128i*)&dst_[i],v);
+
+  cpu_fill32_c(&dst_[i],val_,count_ - i);
+}
+
+static
+CPU_TARGET("sse2")
+void
+cpu_fill32_mask_sse2(uint32_t       *dst_,
+                     const uint32_t  val_,
+                     const uint32_t  mask_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i d;
+  __m128i v;
+  __m128i m;
+
+  v = _mm_set1_epi32(val_);
+  m = _mm_set1_epi32(mask_);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    {
+      d = _mm_loadu_si128((const __m128i*)&dst_[i]);
+      d = _mm_xor_si128(_mm_and_si128(_mm_xor_si128(d,v),m),v);
+      _mm_storeu_si128((__m128i*)&dst_[i],d);
+    }
+
+  cpu_fill32_mask_c(&dst_[i],val_,mask_,count_ - i);
+}
+
+static
+CPU_TARGET("sse2")
+void
+cpu_copy32_mask_sse2(uint32_t       *dst_,
+                     const uint32_t *src_,
+                     const uint32_t  mask_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i d;
+  __m128i s;
+  __m128i m;
+
+  m = _mm_set1_epi32(mask_);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    {
+      d = _mm_loadu_si128((const __m128i*)&dst_[i]);
+      s = _mm_loadu_si128((const __m128i*)&src_[i]);
+      d = _mm_xor_si128(_mm_and_si128(_mm_xor_si128(d,s),m),s);
+      _mm_storeu_si128((__m128i*)&dst_[i],d);
+    }
+
+  cpu_copy32_mask_c(&dst_[i],&src_[i],mask_,count_ - i);
+}
+
+/* bytes within each 16bit lane, then the 16bit halves */
+static
+CPU_TARGET("sse2")
+void
+cpu_bswap32_sse2(uint32_t       *buf_,
+                 const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i v;
+
+  for(i = 0; (i + 4) <= count_; i += 4)
+    {
+      v = _mm_loadu_si128((const __m128i*)&buf_[i]);
+      v = _mm_or_si128(_mm_slli_epi16(v,8),_mm_srli_epi16(v,8));
+      v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v,0xB1),0xB1);
+      _mm_storeu_si128((__m128i*)&buf_[i],v);
+    }
+
+  cpu_bswap32_c(&buf_[i],count_ - i);
+}
+
+/*
+  The first halfword of a word is its low half on x86. Results which
+  fit in 15 bits pack exactly with the signed packs, RGB565 is sign
+  extended first so the saturation never kicks in.
+*/
+static
+CPU_TARGET("sse2")
+void
+cpu_vdlp_0rgb1555_sse2(uint16_t       *dst_,
+                       const uint32_t *src_,
+                       const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i a;
+  __m128i b;
+  __m128i m;
+
+  m = _mm_set1_epi32(0x7FFF);
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      a = _mm_and_si128(_mm_loadu_si128((const __m128i*)&src_[i + 0]),m);
+      b = _mm_and_si128(_mm_loadu_si128((const __m128i*)&src_[i + 4]),m);
+      _mm_storeu_si128((__m128i*)&dst_[i],_mm_packs_epi32(a,b));
+    }
+
+  cpu_vdlp_0rgb1555_c(&dst_[i],&src_[i],count_ - i);
+}
+
+static
+CPU_TARGET("sse2")
+__m128i
+cpu_vdlp_rgb565_x4_sse2(const __m128i v_)
+{
+  __m128i v;
+
+  v = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v_,_mm_set1_epi32(0x7FE0)),1),
+                   _mm_and_si128(v_,_mm_set1_epi32(0x001F)));
+
+  return _mm_srai_epi32(_mm_slli_epi32(v,16),16);
+}
+
+static
+CPU_TARGET("sse2")
+void
+cpu_vdlp_rgb565_sse2(uint16_t       *dst_,
+                     const uint32_t *src_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i a;
+  __m128i b;
+
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      a = cpu_vdlp_rgb565_x4_sse2(_mm_loadu_si128((const __m128i*)&src_[i + 0]));
+      b = cpu_vdlp_rgb565_x4_sse2(_mm_loadu_si128((const __m128i*)&src_[i + 4]));
+      _mm_storeu_si128((__m128i*)&dst_[i],_mm_packs_epi32(a,b));
+    }
+
+  cpu_vdlp_rgb565_c(&dst_[i],&src_[i],count_ - i);
+}
+
+static
+CPU_TARGET("sse2")
+void
+cpu_vdlp_xrgb8888_sse2(uint32_t       *dst_,
+                       const uint32_t *src_,
+                       const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i v;
+  __m128i r;
+  __m128i g;
+  __m128i b;
+
+  for(i = 0; (i + 4) <= count_; i += 4)
+    {
+      v = _mm_loadu_si128((const __m128i*)&src_[i]);
+      r = _mm_slli_epi32(_mm_and_si128(v,_mm_set1_epi32(0x7C00)),0x9);
+      g = _mm_slli_epi32(_mm_and_si128(v,_mm_set1_epi32(0x03E0)),0x6);
+      b = _mm_slli_epi32(_mm_and_si128(v,_mm_set1_epi32(0x001F)),0x3);
+      _mm_storeu_si128((__m128i*)&dst_[i],_mm_or_si128(_mm_or_si128(r,g),b));
+    }
+
+  cpu_vdlp_xrgb8888_c(&dst_[i],&src_[i],count_ - i);
+}
+
+/* SSE4.1, which implies SSSE3's byte shuffle */
+
+static
+CPU_TARGET("sse4.1")
+void
+cpu_bswap32_sse41(uint32_t       *buf_,
+                  const uint32_t  count_)
+{
+  uint32_t i;
+  __m128i v;
+  __m128i shuf;
+
+  shuf = _mm_set_epi8(12,13,14,15,8,9,10,11,4,5,6,7,0,1,2,3);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    {
+      v = _mm_loadu_si128((const __m128i*)&buf_[i]);
+      _mm_storeu_si128((__m128i*)&buf_[i],_mm_shuffle_epi8(v,shuf));
+    }
+
+  cpu_bswap32_c(&buf_[i],count_ - i);
+}
+
+/* AVX2 */
+
+static
+CPU_TARGET("avx2")
+void
+cpu_fill32_avx2(uint32_t       *dst_,
+                const uint32_t  val_,
+                const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i v;
+
+  v = _mm256_set1_epi32(val_);
+  for(i = 0; (i + 8) <= count_; i += 8)
+    _mm256_storeu_si256((__m256i*)&dst_[i],v);
+
+  cpu_fill32_c(&dst_[i],val_,count_ - i);
+}
+
+static
+CPU_TARGET("avx2")
+void
+cpu_fill32_mask_avx2(uint32_t       *dst_,
+                     const uint32_t  val_,
+                     const uint32_t  mask_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i d;
+  __m256i v;
+  __m256i m;
+
+  v = _mm256_set1_epi32(val_);
+  m = _mm256_set1_epi32(mask_);
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      d = _mm256_loadu_si256((const __m256i*)&dst_[i]);
+      d = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(d,v),m),v);
+      _mm256_storeu_si256((__m256i*)&dst_[i],d);
+    }
+
+  cpu_fill32_mask_c(&dst_[i],val_,mask_,count_ - i);
+}
+
+static
+CPU_TARGET("avx2")
+void
+cpu_copy32_mask_avx2(uint32_t       *dst_,
+                     const uint32_t *src_,
+                     const uint32_t  mask_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i d;
+  __m256i s;
+  __m256i m;
+
+  m = _mm256_set1_epi32(mask_);
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      d = _mm256_loadu_si256((const __m256i*)&dst_[i]);
+      s = _mm256_loadu_si256((const __m256i*)&src_[i]);
+      d = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(d,s),m),s);
+      _mm256_storeu_si256((__m256i*)&dst_[i],d);
+    }
+
+  cpu_copy32_mask_c(&dst_[i],&src_[i],mask_,count_ - i);
+}
+
+static
+CPU_TARGET("avx2")
+void
+cpu_bswap32_avx2(uint32_t       *buf_,
+                 const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i v;
+  __m256i shuf;
+
+  shuf = _mm256_set_epi8(12,13,14,15,8,9,10,11,4,5,6,7,0,1,2,3,
+                         12,13,14,15,8,9,10,11,4,5,6,7,0,1,2,3);
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      v = _mm256_loadu_si256((const __m256i*)&buf_[i]);
+      _mm256_storeu_si256((__m256i*)&buf_[i],_mm256_shuffle_epi8(v,shuf));
+    }
+
+  cpu_bswap32_c(&buf_[i],count_ - i);
+}
+
+/* the packs work per 128bit lane, 0xD8 puts the quarters back in order */
+static
+CPU_TARGET("avx2")
+void
+cpu_vdlp_0rgb1555_avx2(uint16_t       *dst_,
+                       const uint32_t *src_,
+                       const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i a;
+  __m256i b;
+  __m256i m;
+
+  m = _mm256_set1_epi32(0x7FFF);
+  for(i = 0; (i + 16) <= count_; i += 16)
+    {
+      a = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src_[i + 0]),m);
+      b = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src_[i + 8]),m);
+      a = _mm256_permute4x64_epi64(_mm256_packs_epi32(a,b),0xD8);
+      _mm256_storeu_si256((__m256i*)&dst_[i],a);
+    }
+
+  cpu_vdlp_0rgb1555_c(&dst_[i],&src_[i],count_ - i);
+}
+
+static
+CPU_TARGET("avx2")
+__m256i
+cpu_vdlp_rgb565_x8_avx2(const __m256i v_)
+{
+  __m256i v;
+
+  v = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v_,_mm256_set1_epi32(0x7FE0)),1),
+                      _mm256_and_si256(v_,_mm256_set1_epi32(0x001F)));
+
+  return _mm256_srai_epi32(_mm256_slli_epi32(v,16),16);
+}
+
+static
+CPU_TARGET("avx2")
+void
+cpu_vdlp_rgb565_avx2(uint16_t       *dst_,
+                     const uint32_t *src_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i a;
+  __m256i b;
+
+  for(i = 0; (i + 16) <= count_; i += 16)
+    {
+      a = cpu_vdlp_rgb565_x8_avx2(_mm256_loadu_si256((const __m256i*)&src_[i + 0]));
+      b = cpu_vdlp_rgb565_x8_avx2(_mm256_loadu_si256((const __m256i*)&src_[i + 8]));
+      a = _mm256_permute4x64_epi64(_mm256_packs_epi32(a,b),0xD8);
+      _mm256_storeu_si256((__m256i*)&dst_[i],a);
+    }
+
+  cpu_vdlp_rgb565_c(&dst_[i],&src_[i],count_ - i);
+}
+
+static
+CPU_TARGET("avx2")
+void
+cpu_vdlp_xrgb8888_avx2(uint32_t       *dst_,
+                       const uint32_t *src_,
+                       const uint32_t  count_)
+{
+  uint32_t i;
+  __m256i v;
+  __m256i r;
+  __m256i g;
+  __m256i b;
+
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      v = _mm256_loadu_si256((const __m256i*)&src_[i]);
+      r = _mm256_slli_epi32(_mm256_and_si256(v,_mm256_set1_epi32(0x7C00)),0x9);
+      g = _mm256_slli_epi32(_mm256_and_si256(v,_mm256_set1_epi32(0x03E0)),0x6);
+      b = _mm256_slli_epi32(_mm256_and_si256(v,_mm256_set1_epi32(0x001F)),0x3);
+      _mm256_storeu_si256((__m256i*)&dst_[i],_mm256_or_si256(_mm256_or_si256(r,g),b));
+    }
+
+  cpu_vdlp_xrgb8888_c(&dst_[i],&src_[i],count_ - i);
+}
+
+#endif /* CPU_X86 */
+
+#ifdef CPU_NEON
+
+static
+void
+cpu_fill32_neon(uint32_t       *dst_,
+                const uint32_t  val_,
+                const uint32_t  count_)
+{
+  uint32_t i;
+  uint32x4_t v;
+
+  v = vdupq_n_u32(val_);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    vst1q_u32(&dst_[i],v);
+
+  cpu_fill32_c(&dst_[i],val_,count_ - i);
+}
+
+/* bit select: set mask bits keep dst */
+static
+void
+cpu_fill32_mask_neon(uint32_t       *dst_,
+                     const uint32_t  val_,
+                     const uint32_t  mask_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  uint32x4_t v;
+  uint32x4_t m;
+
+  v = vdupq_n_u32(val_);
+  m = vdupq_n_u32(mask_);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    vst1q_u32(&dst_[i],vbslq_u32(m,vld1q_u32(&dst_[i]),v));
+
+  cpu_fill32_mask_c(&dst_[i],val_,mask_,count_ - i);
+}
+
+static
+void
+cpu_copy32_mask_neon(uint32_t       *dst_,
+                     const uint32_t *src_,
+                     const uint32_t  mask_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  uint32x4_t m;
+
+  m = vdupq_n_u32(mask_);
+  for(i = 0; (i + 4) <= count_; i += 4)
+    vst1q_u32(&dst_[i],vbslq_u32(m,vld1q_u32(&dst_[i]),vld1q_u32(&src_[i])));
+
+  cpu_copy32_mask_c(&dst_[i],&src_[i],mask_,count_ - i);
+}
+
+static
+void
+cpu_bswap32_neon(uint32_t       *buf_,
+                 const uint32_t  count_)
+{
+  uint32_t i;
+  uint8x16_t v;
+
+  for(i = 0; (i + 4) <= count_; i += 4)
+    {
+      v = vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(&buf_[i])));
+      vst1q_u32(&buf_[i],vreinterpretq_u32_u8(v));
+    }
+
+  cpu_bswap32_c(&buf_[i],count_ - i);
+}
+
+/* vld2 splits the halfwords in memory order, val[0] are the pixels */
+static
+void
+cpu_vdlp_0rgb1555_neon(uint16_t       *dst_,
+                       const uint32_t *src_,
+                       const uint32_t  count_)
+{
+  uint32_t i;
+  uint16x8x2_t v;
+
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      v = vld2q_u16((const uint16_t*)&src_[i]);
+      vst1q_u16(&dst_[i],vandq_u16(v.val[0],vdupq_n_u16(0x7FFF)));
+    }
+
+  cpu_vdlp_0rgb1555_c(&dst_[i],&src_[i],count_ - i);
+}
+
+static
+void
+cpu_vdlp_rgb565_neon(uint16_t       *dst_,
+                     const uint32_t *src_,
+                     const uint32_t  count_)
+{
+  uint32_t i;
+  uint16x8_t p;
+
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      p = vld2q_u16((const uint16_t*)&src_[i]).val[0];
+      p = vorrq_u16(vshlq_n_u16(vandq_u16(p,vdupq_n_u16(0x7FE0)),1),
+                    vandq_u16(p,vdupq_n_u16(0x001F)));
+      vst1q_u16(&dst_[i],p);
+    }
+
+  cpu_vdlp_rgb565_c(&dst_[i],&src_[i],count_ - i);
+}
+
+static
+uint32x4_t
+cpu_vdlp_xrgb8888_x4_neon(const uint32x4_t p_)
+{
+  uint32x4_t r;
+  uint32x4_t g;
+  uint32x4_t b;
+
+  r = vshlq_n_u32(vandq_u32(p_,vdupq_n_u32(0x7C00)),0x9);
+  g = vshlq_n_u32(vandq_u32(p_,vdupq_n_u32(0x03E0)),0x6);
+  b = vshlq_n_u32(vandq_u32(p_,vdupq_n_u32(0x001F)),0x3);
+
+  return vorrq_u32(vorrq_u32(r,g),b);
+}
+
+static
+void
+cpu_vdlp_xrgb8888_neon(uint32_t       *dst_,
+                       const uint32_t *src_,
+                       const uint32_t  count_)
+{
+  uint32_t i;
+  uint16x8_t p;
+
+  for(i = 0; (i + 8) <= count_; i += 8)
+    {
+      p = vld2q_u16((const uint16_t*)&src_[i]).val[0];
+      vst1q_u32(&dst_[i + 0],cpu_vdlp_xrgb8888_x4_neon(vmovl_u16(vget_low_u16(p))));
+      vst1q_u32(&dst_[i + 4],cpu_vdlp_xrgb8888_x4_neon(vmovl_u16(vget_high_u16(p))));
+    }
+
+  cpu_vdlp_xrgb8888_c(&dst_[i],&src_[i],count_ - i);
+}
+
+#endif /* CPU_NEON */
+
+THREAD_LOCAL opera_cpu_t OPERA_CPU =
+  {
+    0,
+    OPERA_CPU_ALL,
+    0,
+    cpu_fill32_c,
+    cpu_fill32_mask_c,
+    cpu_copy32_mask_c,
+    cpu_bswap32_c,
+    cpu_vdlp_0rgb1555_c,
+    cpu_vdlp_rgb565_c,
+    cpu_vdlp_xrgb8888_c
+  };
+
+static
+uint32_t
+cpu_detect(void)
+{
+  uint32_t features;
+
+  features = 0;
+
+#ifdef CPU_X86
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("sse2"))
+    features |= OPERA_CPU_SSE2;
+  if(__builtin_cpu_supports("sse4.1"))
+    features |= OPERA_CPU_SSE41;
+  if(__builtin_cpu_supports("avx2"))
+    features |= OPERA_CPU_AVX2;
+#endif
+
+#ifdef CPU_NEON
+  features |= OPERA_CPU_NEON;
+#endif
+
+  return features;
+}
+
+/* later tiers override earlier ones kernel by kernel */
+static
+void
+cpu_bind(void)
+{
+  uint32_t f;
+
+  f = (OPERA_CPU.detected & OPERA_CPU.mask);
+
+  OPERA_CPU.features      = f;
+  OPERA_CPU.fill32        = cpu_fill32_c;
+  OPERA_CPU.fill32_mask   = cpu_fill32_mask_c;
+  OPERA_CPU.copy32_mask   = cpu_copy32_mask_c;
+  OPERA_CPU.bswap32       = cpu_bswap32_c;
+  OPERA_CPU.vdlp_0rgb1555 = cpu_vdlp_0rgb1555_c;
+  OPERA_CPU.vdlp_rgb565   = cpu_vdlp_rgb565_c;
+  OPERA_CPU.vdlp_xrgb8888 = cpu_vdlp_xrgb8888_c;
+
+#ifdef CPU_X86
+  if(f & OPERA_CPU_SSE2)
+    {
+      OPERA_CPU.fill32        = cpu_fill32_sse2;
+      OPERA_CPU.fill32_mask   = cpu_fill32_mask_sse2;
+      OPERA_CPU.copy32_mask   = cpu_copy32_mask_sse2;
+      OPERA_CPU.bswap32       = cpu_bswap32_sse2;
+      OPERA_CPU.vdlp_0rgb1555 = cpu_vdlp_0rgb1555_sse2;
+      OPERA_CPU.vdlp_rgb565   = cpu_vdlp_rgb565_sse2;
+      OPERA_CPU.vdlp_xrgb8888 = cpu_vdlp_xrgb8888_sse2;
+    }
+
+  if(f & OPERA_CPU_SSE41)
+    OPERA_CPU.bswap32 = cpu_bswap32_sse41;
+
+  if(f & OPERA_CPU_AVX2)
+    {
+      OPERA_CPU.fill32        = cpu_fill32_avx2;
+      OPERA_CPU.fill32_mask   = cpu_fill32_mask_avx2;
+      OPERA_CPU.copy32_mask   = cpu_copy32_mask_avx2;
+      OPERA_CPU.bswap32       = cpu_bswap32_avx2;
+      OPERA_CPU.vdlp_0rgb1555 = cpu_vdlp_0rgb1555_avx2;
+      OPERA_CPU.vdlp_rgb565   = cpu_vdlp_rgb565_avx2;
+      OPERA_CPU.vdlp_xrgb8888 = cpu_vdlp_xrgb8888_avx2;
+    }
+#endif
+
+#ifdef CPU_NEON
+  if(f & OPERA_CPU_NEON)
+    {
+      OPERA_CPU.fill32        = cpu_fill32_neon;
+      OPERA_CPU.fill32_mask   = cpu_fill32_mask_neon;
+      OPERA_CPU.copy32_mask   = cpu_copy32_mask_neon;
+      OPERA_CPU.bswap32       = cpu_bswap32_neon;
+      OPERA_CPU.vdlp_0rgb1555 = cpu_vdlp_0rgb1555_neon;
+      OPERA_CPU.vdlp_rgb565   = cpu_vdlp_rgb565_neon;
+      OPERA_CPU.vdlp_xrgb8888 = cpu_vdlp_xrgb8888_neon;
+    }
+#endif
+}
+
+/* keeps any override made before init */
+void
+opera_cpu_init(void)
+{
+  OPERA_CPU.detected = cpu_detect();
+  cpu_bind();
+}
+
+void
+opera_cpu_override(const uint32_t mask_)
+{
+  OPERA_CPU.mask = mask_;
+  cpu_bind();
+}
+
+uint32_t
+opera_cpu_detected(void)
+{
+  return OPERA_CPU.detected;
+}
+
+uint32_t
+opera_cpu_features(void)
+{
+  return OPERA_CPU.features;
+}
@@ -0,0 +1,83 @@
+#ifndef LIBOPERA_CPU_H_INCLUDED
+#define LIBOPERA_CPU_H_INCLUDED
+
+#include "extern_c.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+
+/*
+  Host CPU feature dispatch for the loops which are plain data
+  parallel work over guest memory: SPORT fills and copies, the ROM /
+  DRAM word byteswap and the VDLP's fixed CLUT line conversion.
+  opera_cpu_init(), called by
+  opera_3do_init(), detects what the host supports and binds each
+  kernel to its best variant. The pointers start out bound to the
+  scalar versions so they are usable before init. Every variant must
+  produce the same bytes as the scalar one.
+
+  opera_cpu_override() limits the features the kernels may use (0
+  forces scalar, OPERA_CPU_ALL lifts the limit) so each variant can be
+  checked and timed on one machine. x86 variants are built with
+  per function target attributes and picked at runtime. NEON variants
+  are only built when the compiler already targets NEON.
+*/
+
+#define OPERA_CPU_SSE2  0x00000001
+#define OPERA_CPU_SSE41 0x00000002
+#define OPERA_CPU_AVX2  0x00000004
+#define OPERA_CPU_NEON  0x00000008
+#define OPERA_CPU_ALL   0xFFFFFFFF
+
+EXTERN_C_BEGIN
+
+typedef void (*opera_cpu_fill32_t)(uint32_t       *dst_,
+                                   const uint32_t  val_,
+                                   const uint32_t  count_);
+typedef void (*opera_cpu_fill32_mask_t)(uint32_t       *dst_,
+                                        const uint32_t  val_,
+                                        const uint32_t  mask_,
+                                        const uint32_t  count_);
+typedef void (*opera_cpu_copy32_mask_t)(uint32_t       *dst_,
+                                        const uint32_t *src_,
+                                        const uint32_t  mask_,
+                                        const uint32_t  count_);
+typedef void (*opera_cpu_bswap32_t)(uint32_t       *buf_,
+                                    const uint32_t  count_);
+typedef void (*opera_cpu_line16_t)(uint16_t       *dst_,
+                                   const uint32_t *src_,
+                                   const uint32_t  count_);
+typedef void (*opera_cpu_line32_t)(uint32_t       *dst_,
+                                   const uint32_t *src_,
+                                   const uint32_t  count_);
+
+struct opera_cpu_s
+{
+  uint32_t                detected;
+  uint32_t                mask;
+  uint32_t                features;
+  /* dst = val */
+  opera_cpu_fill32_t      fill32;
+  /* dst = mask ? dst : val, per bit */
+  opera_cpu_fill32_mask_t fill32_mask;
+  /* dst = mask ? dst : src, per bit */
+  opera_cpu_copy32_mask_t copy32_mask;
+  opera_cpu_bswap32_t     bswap32;
+  /* dst = fixed CLUT color of the first halfword of each src word */
+  opera_cpu_line16_t      vdlp_0rgb1555;
+  opera_cpu_line16_t      vdlp_rgb565;
+  opera_cpu_line32_t      vdlp_xrgb8888;
+};
+
+typedef struct opera_cpu_s opera_cpu_t;
+
+extern THREAD_LOCAL opera_cpu_t OPERA_CPU;
+
+void     opera_cpu_init(void);
+void     opera_cpu_override(const uint32_t mask_);
+uint32_t opera_cpu_detected(void);
+uint32_t opera_cpu_features(void);
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_CPU_H_INCLUDED */
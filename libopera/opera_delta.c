@@ -0,0 +1,576 @@
+#include "opera_3do.h"
+#include "opera_arm.h"
+#include "opera_delta.h"
+#include "opera_dirty.h"
+#include "opera_hires.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DELTA_MAGIC          0x97970103
+#define DELTA_FLAG_KEYFRAME  0x00000001
+#define DELTA_FLAG_STEP      0x00000002
+#define DELTA_ALIGN(X)       (((X) + 3) & ~3)
+
+struct opera_delta_header_s
+{
+  uint32_t magic;
+  uint32_t flags;
+  uint32_t keyframe_id;
+  uint32_t size;
+  uint32_t chip_size;
+  uint32_t page_count;
+};
+
+typedef struct opera_delta_header_s opera_delta_header_t;
+
+struct opera_delta_s
+{
+  int       dirty_id;
+  uint32_t  keyframe_id;
+  uint32_t  keyframe_pages;
+  uint32_t  interval;
+  uint32_t  since_keyframe;
+  uint8_t  *base;
+  uint8_t  *chip;
+};
+
+opera_delta_t*
+opera_delta_new(void)
+{
+  opera_delta_t *d;
+
+  d = calloc(1,sizeof(opera_delta_t));
+  if(d == NULL)
+    return NULL;
+
+  d->base = calloc(1,OPERA_DIRTY_MEM_SIZE);
+  if(d->base == NULL)
+    {
+      free(d);
+      return NULL;
+    }
+
+  d->dirty_id = opera_dirty_register();
+  if(d->dirty_id < 0)
+    {
+      free(d->base);
+      free(d);
+      return NULL;
+    }
+
+  d->interval = OPERA_DELTA_DEFAULT_KEYFRAME_INTERVAL;
+
+  return d;
+}
+
+void
+opera_delta_free(opera_delta_t *d_)
+{
+  if(d_ == NULL)
+    return;
+
+  opera_dirty_unregister(d_->dirty_id);
+  free(d_->chip);
+  free(d_->base);
+  free(d_);
+}
+
+void
+opera_delta_set_keyframe_interval(opera_delta_t  *d_,
+                                  const uint32_t  interval_)
+{
+  d_->interval = interval_;
+}
+
+void
+opera_delta_force_keyframe(opera_delta_t *d_)
+{
+  d_->keyframe_id = 0;
+}
+
+uint32_t
+opera_delta_max_size(void)
+{
+  return (sizeof(opera_delta_header_t) +
+          DELTA_ALIGN(opera_3do_chip_state_size()) +
+          (OPERA_DIRTY_PAGE_COUNT * (sizeof(uint32_t) + OPERA_DIRTY_PAGE_SIZE)));
+}
+
+static
+uint32_t
+delta_count_dirty(const opera_delta_t *d_)
+{
+  int32_t page;
+  uint32_t count;
+
+  count = 0;
+  page  = opera_dirty_next(d_->dirty_id,0);
+  while(page >= 0)
+    {
+      count++;
+      page = opera_dirty_next(d_->dirty_id,page + 1);
+    }
+
+  return count;
+}
+
+static
+int
+delta_need_keyframe(const opera_delta_t *d_)
+{
+  if(d_->keyframe_id == 0)
+    return 1;
+  if(d_->since_keyframe >= d_->interval)
+    return 1;
+
+  return 0;
+}
+
+static
+void
+delta_mark_page(const uint32_t page_)
+{
+  opera_dirty_mark_range(page_ << OPERA_DIRTY_PAGE_SHIFT,OPERA_DIRTY_PAGE_SIZE);
+  opera_hires_flatten(page_ << OPERA_DIRTY_PAGE_SHIFT,OPERA_DIRTY_PAGE_SIZE);
+}
+
+static
+uint32_t
+delta_save_keyframe(opera_delta_t *d_,
+                    uint32_t      *idx_)
+{
+  uint32_t i;
+  uint32_t pages;
+  uint8_t *ram;
+  uint8_t *data;
+
+  ram   = opera_arm_ram_get();
+  pages = OPERA_DIRTY_PAGE_COUNT;
+
+  for(i = 0; i < pages; i++)
+    idx_[i] = i;
+
+  data = (uint8_t*)&idx_[pages];
+  memcpy(data,ram,pages << OPERA_DIRTY_PAGE_SHIFT);
+  memcpy(d_->base,ram,pages << OPERA_DIRTY_PAGE_SHIFT);
+
+  opera_dirty_clear(d_->dirty_id);
+
+  d_->keyframe_id++;
+  if(d_->keyframe_id == 0)
+    d_->keyframe_id++;
+  d_->keyframe_pages = pages;
+  d_->since_keyframe = 0;
+
+  return pages;
+}
+
+static
+uint32_t
+delta_save_pages(opera_delta_t *d_,
+                 uint32_t      *idx_,
+                 const uint32_t count_)
+{
+  uint32_t i;
+  int32_t page;
+  uint8_t *ram;
+  uint8_t *data;
+
+  ram  = opera_arm_ram_get();
+  data = (uint8_t*)&idx_[count_];
+
+  i    = 0;
+  page = opera_dirty_next(d_->dirty_id,0);
+  while((page >= 0) && (i < count_))
+    {
+      idx_[i] = page;
+      memcpy(&data[i << OPERA_DIRTY_PAGE_SHIFT],
+             &ram[page << OPERA_DIRTY_PAGE_SHIFT],
+             OPERA_DIRTY_PAGE_SIZE);
+      i++;
+      page = opera_dirty_next(d_->dirty_id,page + 1);
+    }
+
+  d_->since_keyframe++;
+
+  return i;
+}
+
+uint32_t
+opera_delta_save(opera_delta_t *d_,
+                 void          *buf_)
+{
+  uint32_t count;
+  uint8_t *chip;
+  uint32_t *idx;
+  opera_delta_header_t *hdr;
+
+  hdr  = buf_;
+  chip = (uint8_t*)&hdr[1];
+
+  hdr->magic     = DELTA_MAGIC;
+  hdr->chip_size = DELTA_ALIGN(opera_3do_chip_state_size());
+  opera_3do_chip_state_save(chip);
+
+  idx = (uint32_t*)&chip[hdr->chip_size];
+
+  /* once more than half of memory is dirty a fresh keyframe is cheaper */
+  count = 0;
+  if(!delta_need_keyframe(d_))
+    count = delta_count_dirty(d_);
+
+  if(delta_need_keyframe(d_) || ((count * 2) > d_->keyframe_pages))
+    {
+      hdr->flags      = DELTA_FLAG_KEYFRAME;
+      hdr->page_count = delta_save_keyframe(d_,idx);
+    }
+  else
+    {
+      hdr->flags      = 0;
+      hdr->page_count = delta_save_pages(d_,idx,count);
+    }
+
+  hdr->keyframe_id = d_->keyframe_id;
+  hdr->size        = (sizeof(opera_delta_header_t) +
+                      hdr->chip_size +
+                      (hdr->page_count * (sizeof(uint32_t) + OPERA_DIRTY_PAGE_SIZE)));
+
+  return hdr->size;
+}
+
+static
+void
+delta_load_keyframe(opera_delta_t              *d_,
+                    const opera_delta_header_t *hdr_,
+                    const uint32_t             *idx_)
+{
+  uint32_t i;
+  uint8_t *ram;
+  const uint8_t *data;
+
+  ram  = opera_arm_ram_get();
+  data = (const uint8_t*)&idx_[hdr_->page_count];
+
+  for(i = 0; i < hdr_->page_count; i++)
+    {
+      memcpy(&ram[idx_[i] << OPERA_DIRTY_PAGE_SHIFT],
+             &data[i << OPERA_DIRTY_PAGE_SHIFT],
+             OPERA_DIRTY_PAGE_SIZE);
+      memcpy(&d_->base[idx_[i] << OPERA_DIRTY_PAGE_SHIFT],
+             &data[i << OPERA_DIRTY_PAGE_SHIFT],
+             OPERA_DIRTY_PAGE_SIZE);
+      delta_mark_page(idx_[i]);
+    }
+
+  opera_dirty_clear(d_->dirty_id);
+
+  d_->keyframe_id    = hdr_->keyframe_id;
+  d_->keyframe_pages = hdr_->page_count;
+  d_->since_keyframe = 0;
+}
+
+static
+void
+delta_load_pages(opera_delta_t              *d_,
+                 const opera_delta_header_t *hdr_,
+                 const uint32_t             *idx_)
+{
+  uint32_t i;
+  int32_t page;
+  uint8_t *ram;
+  const uint8_t *data;
+
+  ram  = opera_arm_ram_get();
+  data = (const uint8_t*)&idx_[hdr_->page_count];
+
+  /* revert everything written since the keyframe */
+  page = opera_dirty_next(d_->dirty_id,0);
+  while(page >= 0)
+    {
+      memcpy(&ram[page << OPERA_DIRTY_PAGE_SHIFT],
+             &d_->base[page << OPERA_DIRTY_PAGE_SHIFT],
+             OPERA_DIRTY_PAGE_SIZE);
+      delta_mark_page(page);
+      page = opera_dirty_next(d_->dirty_id,page + 1);
+    }
+
+  for(i = 0; i < hdr_->page_count; i++)
+    memcpy(&ram[idx_[i] << OPERA_DIRTY_PAGE_SHIFT],
+           &data[i << OPERA_DIRTY_PAGE_SHIFT],
+           OPERA_DIRTY_PAGE_SIZE);
+
+  /* memory now differs from the keyframe in exactly these pages */
+  opera_dirty_clear(d_->dirty_id);
+  for(i = 0; i < hdr_->page_count; i++)
+    delta_mark_page(idx_[i]);
+}
+
+/*
+  Returns -1 if the record is invalid or is a delta against a keyframe
+  other than the one last saved or loaded with this context.
+*/
+int
+opera_delta_load(opera_delta_t *d_,
+                 const void    *buf_)
+{
+  const uint8_t *chip;
+  const uint32_t *idx;
+  const opera_delta_header_t *hdr;
+
+  hdr = buf_;
+  if(hdr->magic != DELTA_MAGIC)
+    return -1;
+  if(hdr->page_count > OPERA_DIRTY_PAGE_COUNT)
+    return -1;
+  if(!(hdr->flags & DELTA_FLAG_KEYFRAME) && (hdr->keyframe_id != d_->keyframe_id))
+    return -1;
+
+  chip = (const uint8_t*)&hdr[1];
+  idx  = (const uint32_t*)&chip[hdr->chip_size];
+
+  if(hdr->flags & DELTA_FLAG_KEYFRAME)
+    delta_load_keyframe(d_,hdr,idx);
+  else
+    delta_load_pages(d_,hdr,idx);
+
+  opera_3do_chip_state_load(chip);
+
+  return 0;
+}
+
+int
+opera_delta_is_keyframe(const void *buf_)
+{
+  const opera_delta_header_t *hdr = buf_;
+
+  return !!(hdr->flags & DELTA_FLAG_KEYFRAME);
+}
+
+uint32_t
+opera_delta_keyframe_id(const void *buf_)
+{
+  const opera_delta_header_t *hdr = buf_;
+
+  return hdr->keyframe_id;
+}
+
+uint32_t
+opera_delta_size(const void *buf_)
+{
+  const opera_delta_header_t *hdr = buf_;
+
+  return hdr->size;
+}
+
+/*
+  In place checkpoints. Making the current state the context's
+  keyframe only needs the pages written since the previous checkpoint
+  copied into the base and rolling back only needs the pages written
+  since copied out of it, so a checkpoint / run / rollback cycle costs
+  what the frames touched rather than a full save state.
+*/
+int
+opera_delta_checkpoint(opera_delta_t *d_)
+{
+  int32_t page;
+  uint8_t *ram;
+
+  if(d_->chip == NULL)
+    {
+      d_->chip = malloc(DELTA_ALIGN(opera_3do_chip_state_size()));
+      if(d_->chip == NULL)
+        return -1;
+    }
+
+  ram = opera_arm_ram_get();
+  if(d_->keyframe_id == 0)
+    {
+      d_->keyframe_pages = OPERA_DIRTY_PAGE_COUNT;
+      memcpy(d_->base,ram,OPERA_DIRTY_MEM_SIZE);
+    }
+  else
+    {
+      page = opera_dirty_next(d_->dirty_id,0);
+      while(page >= 0)
+        {
+          memcpy(&d_->base[page << OPERA_DIRTY_PAGE_SHIFT],
+                 &ram[page << OPERA_DIRTY_PAGE_SHIFT],
+                 OPERA_DIRTY_PAGE_SIZE);
+          page = opera_dirty_next(d_->dirty_id,page + 1);
+        }
+    }
+
+  opera_dirty_clear(d_->dirty_id);
+  opera_3do_chip_state_save(d_->chip);
+
+  /* records saved against the previous keyframe no longer apply */
+  d_->keyframe_id++;
+  if(d_->keyframe_id == 0)
+    d_->keyframe_id++;
+  d_->since_keyframe = 0;
+
+  return 0;
+}
+
+int
+opera_delta_rollback(opera_delta_t *d_)
+{
+  int32_t page;
+  uint8_t *ram;
+
+  if(d_->chip == NULL)
+    return -1;
+
+  ram  = opera_arm_ram_get();
+  page = opera_dirty_next(d_->dirty_id,0);
+  while(page >= 0)
+    {
+      memcpy(&ram[page << OPERA_DIRTY_PAGE_SHIFT],
+             &d_->base[page << OPERA_DIRTY_PAGE_SHIFT],
+             OPERA_DIRTY_PAGE_SIZE);
+      delta_mark_page(page);
+      page = opera_dirty_next(d_->dirty_id,page + 1);
+    }
+
+  opera_dirty_clear(d_->dirty_id);
+  opera_3do_chip_state_load(d_->chip);
+
+  return 0;
+}
+
+/*
+  Step records. The base holds memory as of the last step saved (or
+  stepped back to) and each record holds the chip state plus the XOR
+  of every page written since the previous record. Undoing them
+  newest first walks back one record at a time; nothing but the base
+  is needed, so the oldest records can simply be dropped.
+*/
+uint32_t
+opera_delta_save_step(opera_delta_t *d_,
+                      void          *buf_)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t count;
+  int32_t page;
+  uint8_t *ram;
+  uint8_t *chip;
+  uint32_t *idx;
+  uint32_t *src;
+  uint32_t *base;
+  uint32_t *data;
+  opera_delta_header_t *hdr;
+
+  hdr  = buf_;
+  chip = (uint8_t*)&hdr[1];
+  ram  = opera_arm_ram_get();
+
+  hdr->magic     = DELTA_MAGIC;
+  hdr->flags     = DELTA_FLAG_STEP;
+  hdr->chip_size = DELTA_ALIGN(opera_3do_chip_state_size());
+  opera_3do_chip_state_save(chip);
+
+  idx = (uint32_t*)&chip[hdr->chip_size];
+
+  /* nothing to chain to yet */
+  count = 0;
+  if(d_->keyframe_id == 0)
+    {
+      memcpy(d_->base,ram,OPERA_DIRTY_MEM_SIZE);
+      d_->keyframe_id = 1;
+    }
+  else
+    {
+      count = delta_count_dirty(d_);
+      data  = (uint32_t*)&idx[count];
+
+      i    = 0;
+      page = opera_dirty_next(d_->dirty_id,0);
+      while((page >= 0) && (i < count))
+        {
+          idx[i] = page;
+          src    = (uint32_t*)&ram[page << OPERA_DIRTY_PAGE_SHIFT];
+          base   = (uint32_t*)&d_->base[page << OPERA_DIRTY_PAGE_SHIFT];
+          for(j = 0; j < (OPERA_DIRTY_PAGE_SIZE / sizeof(uint32_t)); j++)
+            {
+              *data++ = (src[j] ^ base[j]);
+              base[j] = src[j];
+            }
+          i++;
+          page = opera_dirty_next(d_->dirty_id,page + 1);
+        }
+      count = i;
+    }
+
+  opera_dirty_clear(d_->dirty_id);
+
+  hdr->keyframe_id = 0;
+  hdr->page_count  = count;
+  hdr->size        = (sizeof(opera_delta_header_t) +
+                      hdr->chip_size +
+                      (count * (sizeof(uint32_t) + OPERA_DIRTY_PAGE_SIZE)));
+
+  return hdr->size;
+}
+
+/*
+  Restores the state the newest step record was saved from, then
+  moves the base back across it so the record before it is next.
+  Returns -1 if the record is invalid or no step was saved yet.
+*/
+int
+opera_delta_load_step(opera_delta_t *d_,
+                      const void    *buf_)
+{
+  uint32_t i;
+  uint32_t j;
+  int32_t page;
+  uint8_t *ram;
+  uint32_t *base;
+  const uint8_t *chip;
+  const uint32_t *idx;
+  const uint32_t *data;
+  const opera_delta_header_t *hdr;
+
+  hdr = buf_;
+  if(hdr->magic != DELTA_MAGIC)
+    return -1;
+  if(!(hdr->flags & DELTA_FLAG_STEP))
+    return -1;
+  if(hdr->page_count > OPERA_DIRTY_PAGE_COUNT)
+    return -1;
+  if(d_->keyframe_id == 0)
+    return -1;
+
+  chip = (const uint8_t*)&hdr[1];
+  idx  = (const uint32_t*)&chip[hdr->chip_size];
+  data = (const uint32_t*)&idx[hdr->page_count];
+  ram  = opera_arm_ram_get();
+
+  /* memory back to the base, which is this record's state */
+  page = opera_dirty_next(d_->dirty_id,0);
+  while(page >= 0)
+    {
+      memcpy(&ram[page << OPERA_DIRTY_PAGE_SHIFT],
+             &d_->base[page << OPERA_DIRTY_PAGE_SHIFT],
+             OPERA_DIRTY_PAGE_SIZE);
+      delta_mark_page(page);
+      page = opera_dirty_next(d_->dirty_id,page + 1);
+    }
+
+  opera_dirty_clear(d_->dirty_id);
+  opera_3do_chip_state_load(chip);
+
+  /* memory now differs from the moved base in exactly these pages */
+  for(i = 0; i < hdr->page_count; i++)
+    {
+      base = (uint32_t*)&d_->base[idx[i] << OPERA_DIRTY_PAGE_SHIFT];
+      for(j = 0; j < (OPERA_DIRTY_PAGE_SIZE / sizeof(uint32_t)); j++)
+        base[j] ^= *data++;
+      opera_dirty_mark_range(idx[i] << OPERA_DIRTY_PAGE_SHIFT,OPERA_DIRTY_PAGE_SIZE);
+    }
+
+  return 0;
+}
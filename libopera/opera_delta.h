@@ -0,0 +1,51 @@
+#ifndef LIBOPERA_DELTA_H_INCLUDED
+#define LIBOPERA_DELTA_H_INCLUDED
+
+#include "extern_c.h"
+
+#include <stdint.h>
+
+/*
+  Incremental save states. A keyframe record holds the chip state and
+  all of DRAM/VRAM. Later records hold the chip state and only the
+  pages written since that keyframe, so any record can be restored
+  given its keyframe. The context keeps a copy of memory as of the
+  current keyframe, which makes both save and restore proportional to
+  the number of pages touched rather than the size of memory.
+
+  Step records instead chain every state to the one saved before it
+  and can only be undone newest first, which is what rewind needs.
+  A context is used either for keyframe / delta records or for step
+  records, not both.
+*/
+
+#define OPERA_DELTA_DEFAULT_KEYFRAME_INTERVAL 60
+
+EXTERN_C_BEGIN
+
+typedef struct opera_delta_s opera_delta_t;
+
+opera_delta_t *opera_delta_new(void);
+void           opera_delta_free(opera_delta_t *delta_);
+
+void           opera_delta_set_keyframe_interval(opera_delta_t  *delta_,
+                                                 const uint32_t  interval_);
+void           opera_delta_force_keyframe(opera_delta_t *delta_);
+
+uint32_t       opera_delta_max_size(void);
+uint32_t       opera_delta_save(opera_delta_t *delta_, void *buf_);
+int            opera_delta_load(opera_delta_t *delta_, const void *buf_);
+
+uint32_t       opera_delta_save_step(opera_delta_t *delta_, void *buf_);
+int            opera_delta_load_step(opera_delta_t *delta_, const void *buf_);
+
+int            opera_delta_is_keyframe(const void *buf_);
+uint32_t       opera_delta_keyframe_id(const void *buf_);
+uint32_t       opera_delta_size(const void *buf_);
+
+int            opera_delta_checkpoint(opera_delta_t *delta_);
+int            opera_delta_rollback(opera_delta_t *delta_);
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_DELTA_H_INCLUDED */
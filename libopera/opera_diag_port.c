@@ -29,13 +29,14 @@
 */
 
 #include "opera_diag_port.h"
-
-static uint16_t SNDDebugFIFO0;
-static uint16_t SNDDebugFIFO1;
-static uint16_t RCVDebugFIFO0;
-static uint16_t RCVDebugFIFO1;
-static uint16_t GetIdx;
-static uint16_t SendIdx;
+#include "thread_local.h"
+
+static THREAD_LOCAL uint16_t SNDDebugFIFO0;
+static THREAD_LOCAL uint16_t SNDDebugFIFO1;
+static THREAD_LOCAL uint16_t RCVDebugFIFO0;
+static THREAD_LOCAL uint16_t RCVDebugFIFO1;
+static THREAD_LOCAL uint16_t GetIdx;
+static THREAD_LOCAL uint16_t SendIdx;
 
 void
 opera_diag_port_init(const int32_t test_code_)
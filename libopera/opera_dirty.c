@@ -0,0 +1,123 @@
+#include "opera_dirty.h"
+#include "thread_local.h"
+
+#include <string.h>
+
+#define SEEN_UNUSED 0xFFFFFFFF
+
+THREAD_LOCAL opera_dirty_t OPERA_DIRTY =
+  {
+    0,
+    1,
+    {
+      SEEN_UNUSED, SEEN_UNUSED, SEEN_UNUSED, SEEN_UNUSED,
+      SEEN_UNUSED, SEEN_UNUSED, SEEN_UNUSED, SEEN_UNUSED
+    }
+  };
+
+int
+opera_dirty_register(void)
+{
+  int i;
+
+  for(i = 0; i < OPERA_DIRTY_MAX_CONSUMERS; i++)
+    {
+      if(OPERA_DIRTY.seen[i] != SEEN_UNUSED)
+        continue;
+
+      OPERA_DIRTY.seen[i] = 0;
+      OPERA_DIRTY.active++;
+
+      return i;
+    }
+
+  return -1;
+}
+
+void
+opera_dirty_unregister(const int id_)
+{
+  if((id_ < 0) || (id_ >= OPERA_DIRTY_MAX_CONSUMERS))
+    return;
+  if(OPERA_DIRTY.seen[id_] == SEEN_UNUSED)
+    return;
+
+  OPERA_DIRTY.seen[id_] = SEEN_UNUSED;
+  OPERA_DIRTY.active--;
+}
+
+void
+opera_dirty_mark_range(const uint32_t addr_,
+                       const uint32_t size_)
+{
+  uint32_t page;
+  uint32_t last;
+
+  if(!OPERA_DIRTY.active || (size_ == 0) || (addr_ >= OPERA_DIRTY_MEM_SIZE))
+    return;
+
+  page = (addr_ >> OPERA_DIRTY_PAGE_SHIFT);
+  last = ((addr_ + size_ - 1) >> OPERA_DIRTY_PAGE_SHIFT);
+  if(last >= OPERA_DIRTY_PAGE_COUNT)
+    last = (OPERA_DIRTY_PAGE_COUNT - 1);
+
+  for(; page <= last; page++)
+    OPERA_DIRTY.pages[page] = OPERA_DIRTY.gen;
+}
+
+/*
+  Used when memory is replaced wholesale (init, state load). As pages
+  then carry a non-zero generation a newly registered consumer sees
+  everything as dirty until it first clears.
+*/
+void
+opera_dirty_mark_all(void)
+{
+  uint32_t i;
+
+  for(i = 0; i < OPERA_DIRTY_PAGE_COUNT; i++)
+    OPERA_DIRTY.pages[i] = OPERA_DIRTY.gen;
+}
+
+uint32_t
+opera_dirty_generation(void)
+{
+  return OPERA_DIRTY.gen;
+}
+
+int
+opera_dirty_page_is_dirty(const int      id_,
+                          const uint32_t page_)
+{
+  return (OPERA_DIRTY.pages[page_] > OPERA_DIRTY.seen[id_]);
+}
+
+int32_t
+opera_dirty_next(const int      id_,
+                 const uint32_t page_)
+{
+  uint32_t i;
+  uint32_t seen;
+
+  seen = OPERA_DIRTY.seen[id_];
+  for(i = page_; i < OPERA_DIRTY_PAGE_COUNT; i++)
+    {
+      if(OPERA_DIRTY.pages[i] > seen)
+        return i;
+    }
+
+  return -1;
+}
+
+/*
+  Everything written so far becomes clean for this consumer. Returns
+  the generation subsequent writes will carry.
+*/
+uint32_t
+opera_dirty_clear(const int id_)
+{
+  OPERA_DIRTY.seen[id_] = OPERA_DIRTY.gen;
+  OPERA_DIRTY.gen++;
+
+  return OPERA_DIRTY.gen;
+}
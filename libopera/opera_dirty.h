@@ -0,0 +1,62 @@
+#ifndef LIBOPERA_DIRTY_H_INCLUDED
+#define LIBOPERA_DIRTY_H_INCLUDED
+
+#include "extern_c.h"
+#include "inline.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+
+/*
+  Write tracking over DRAM and VRAM at 1KiB granularity. Every write
+  stores the current generation into the page's slot. A consumer
+  remembers the generation at which it last cleared and a page is
+  dirty for it if written since. Nothing is recorded while no
+  consumer is registered.
+*/
+
+#define OPERA_DIRTY_PAGE_SHIFT    10
+#define OPERA_DIRTY_PAGE_SIZE     (1 << OPERA_DIRTY_PAGE_SHIFT)
+#define OPERA_DIRTY_MEM_SIZE      (3 * 1024 * 1024)
+#define OPERA_DIRTY_PAGE_COUNT    (OPERA_DIRTY_MEM_SIZE >> OPERA_DIRTY_PAGE_SHIFT)
+#define OPERA_DIRTY_MAX_CONSUMERS 8
+
+EXTERN_C_BEGIN
+
+struct opera_dirty_s
+{
+  uint32_t active;
+  uint32_t gen;
+  uint32_t seen[OPERA_DIRTY_MAX_CONSUMERS];
+  uint32_t pages[OPERA_DIRTY_PAGE_COUNT];
+};
+
+typedef struct opera_dirty_s opera_dirty_t;
+
+extern THREAD_LOCAL opera_dirty_t OPERA_DIRTY;
+
+static
+FORCEINLINE
+void
+opera_dirty_mark(const uint32_t addr_)
+{
+  if(!OPERA_DIRTY.active || (addr_ >= OPERA_DIRTY_MEM_SIZE))
+    return;
+
+  OPERA_DIRTY.pages[addr_ >> OPERA_DIRTY_PAGE_SHIFT] = OPERA_DIRTY.gen;
+}
+
+int      opera_dirty_register(void);
+void     opera_dirty_unregister(const int id_);
+
+void     opera_dirty_mark_range(const uint32_t addr_, const uint32_t size_);
+void     opera_dirty_mark_all(void);
+
+uint32_t opera_dirty_generation(void);
+int      opera_dirty_page_is_dirty(const int id_, const uint32_t page_);
+int32_t  opera_dirty_next(const int id_, const uint32_t page_);
+uint32_t opera_dirty_clear(const int id_);
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_DIRTY_H_INCLUDED */
@@ -29,13 +29,21 @@
 */
 
 #include "bool.h"
+#include "cache_aligned.h"
+#include "endianness.h"
 #include "inline.h"
 #include "opera_clio.h"
 #include "opera_core.h"
 #include "opera_dsp.h"
+#include "opera_perf.h"
+#include "thread_local.h"
 
 #include <string.h>
 
+#if IS_BIG_ENDIAN && defined(OPERA_MULTI_INSTANCE)
+#include <pthread.h>
+#endif
+
 #if 0 //20 bit ALU
 #define ALUSIZEMASK 0xFFFFF000
 #else //32 bit ALU
@@ -217,17 +225,14 @@ typedef struct INTAG_s INTAG_t;
 
 struct dsp_s
 {
-  uint32_t   RBASEx4;
-  INSTTRAS_t INSTTRAS[0x8000];
-  uint16_t   REGCONV[8][16];
-  int        BRCONDTAB[32][32];
-  uint16_t   NMem[2048];
-  uint16_t   IMem[1024];
-  int        REGi;
-  REGSTAG_t  dregs;
-  INTAG_t    flags;
-  uint32_t   g_seed;
-  int        CPUSupply[16];
+  uint32_t  RBASEx4;
+  uint16_t  NMem[2048];
+  uint16_t  IMem[1024];
+  int       REGi;
+  REGSTAG_t dregs;
+  INTAG_t   flags;
+  uint32_t  g_seed;
+  int       CPUSupply[16];
 };
 
 typedef struct dsp_s dsp_t;
@@ -249,7 +254,174 @@ typedef union dsp_alu_flags_u dsp_alu_flags_t;
 
 #pragma pack(pop)
 
-static dsp_t DSP;
+#if IS_BIG_ENDIAN
+/*
+  The generated tables are indexed through little endian bitfield
+  layouts so big endian hosts build them at init instead. Shared
+  between instances, see thread_local.h
+*/
+static INSTTRAS_t INSTTRAS[0x8000];
+static uint16_t   REGCONV[8][16];
+static uint8_t    BRCONDTAB[32][32];
+
+static
+uint16_t
+dsp_register_base(uint32_t reg_,
+                  uint32_t rmap_)
+{
+  uint8_t x;
+  uint8_t y;
+  uint8_t twi;
+
+  reg_ &= 0x0000000F;
+  x     = ((reg_ >> 2) & 1);
+  y     = ((reg_ >> 3) & 1);
+
+  switch(rmap_)
+    {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      twi = x;
+      break;
+    case 4:
+      twi = y;
+      break;
+    case 5:
+      twi = !y;
+      break;
+    case 6:
+      twi = x & y;
+      break;
+    case 7:
+      twi = x | y;
+      break;
+    }
+
+  return ((reg_ & 7) | (twi << 8) | (reg_ >> 3) << 9);
+}
+
+static
+void
+dsp_tables_init(void)
+{
+  int32_t a,c;
+  ITAG_t inst;
+  REQ_t req;
+
+  for(a = 0; a < 16; a++)
+    for(c = 0; c < 8; c++)
+      REGCONV[c][a] = dsp_register_base(a,c);
+
+  for(inst.raw = 0; inst.raw < 0x8000; inst.raw++)
+    {
+      req.raw = 0;
+
+      if(inst.aif.BS == 0x8)
+        req.rq.BS = 1;
+
+      switch(inst.aif.MUXA)
+        {
+        case 3:
+          req.rq.MULT1 = 1;
+          req.rq.MULT2 = inst.aif.M2SEL;
+          break;
+        case 1:
+          req.rq.ALU1 = 1;
+          break;
+        case 2:
+          req.rq.ALU2 = 1;
+          break;
+        }
+
+      switch(inst.aif.MUXB)
+        {
+        case 1:
+          req.rq.ALU1 = 1;
+          break;
+        case 2:
+          req.rq.ALU2 = 1;
+          break;
+        case 3:
+          req.rq.MULT1 = 1;
+          req.rq.MULT2 = inst.aif.M2SEL;
+          break;
+        }
+
+      INSTTRAS[inst.raw].req.raw = req.raw;
+      INSTTRAS[inst.raw].BS      = (inst.aif.BS | ((inst.aif.ALU & 8) << (4 - 3)));
+    }
+
+  {
+    int MD1, MD2, MD3;
+    int STAT0, STAT1;
+    int NSTAT0, NSTAT1;
+    int TDCARE0, TDCARE1;
+    int RDCARE;
+    int MD12S;
+    int SUPER0, SUPER1;
+    int ALLZERO, NALLZERO;
+    int SDS;
+    int NVTest;
+    int TMPCS;
+    int CZTest, XactTest;
+    int MD3S;
+    int fExact;
+
+    dsp_alu_flags_t flags;
+
+    flags.raw = 0;
+    for(inst.raw = 0xA000; inst.raw <= 0xFFFF; inst.raw += 1024)
+      for(flags.zero = 0; flags.zero < 2; flags.zero++)
+        for(flags.negative = 0; flags.negative < 2; flags.negative++)
+          for(flags.carry = 0; flags.carry < 2; flags.carry++)
+            for(flags.overflow = 0; flags.overflow < 2; flags.overflow++)
+              for(fExact = 0; fExact < 2; fExact++)
+                {
+                  MD1 = !inst.branch.MODE1 && inst.branch.MODE0;
+                  MD2 = inst.branch.MODE1 && !inst.branch.MODE0;
+                  MD3 = inst.branch.MODE1 && inst.branch.MODE0;
+
+                  STAT0  = (inst.branch.FLAGSEL && flags.carry) || (!inst.branch.FLAGSEL && flags.negative);
+                  STAT1  = (inst.branch.FLAGSEL && flags.zero) || (!inst.branch.FLAGSEL && flags.overflow);
+                  NSTAT0 = STAT0 != MD2;
+                  NSTAT1 = STAT1 != MD2;
+
+                  TDCARE1 = !inst.branch.FLAGM1 || (inst.branch.FLAGM1 && NSTAT0);
+                  TDCARE0 = !inst.branch.FLAGM0 || (inst.branch.FLAGM0 && NSTAT1);
+
+                  RDCARE = !inst.branch.FLAGM1 && !inst.branch.FLAGM0;
+
+                  MD12S = TDCARE1 && TDCARE0 && (inst.branch.MODE1!=inst.branch.MODE0) && !RDCARE;
+
+                  SUPER0 = MD1 && !inst.branch.FLAGSEL && RDCARE;
+                  SUPER1 = MD1 && inst.branch.FLAGSEL &&  RDCARE;
+
+                  ALLZERO  = SUPER0 && flags.zero && fExact;
+                  NALLZERO = SUPER1 && !(flags.zero && fExact);
+
+                  SDS = ALLZERO || NALLZERO;
+
+                  NVTest   = ((((flags.negative != flags.overflow) ||
+                                (flags.zero && inst.branch.FLAGM0)) != inst.branch.FLAGM1) &&
+                              !inst.branch.FLAGSEL);
+                  TMPCS    = flags.carry && !flags.zero;
+                  CZTest   = (TMPCS != inst.branch.FLAGM0) && inst.branch.FLAGSEL && !inst.branch.FLAGM1;
+                  XactTest = (fExact != inst.branch.FLAGM0) && inst.branch.FLAGSEL && inst.branch.FLAGM1;
+
+                  MD3S = ((NVTest || CZTest || XactTest) && MD3);
+
+                  BRCONDTAB[inst.br.bits][fExact+((flags.raw*0x10080402)>>24)] = (MD12S || MD3S || SDS);
+                }
+  }
+}
+#else
+/* INSTTRAS, REGCONV and BRCONDTAB: see tools/opera_gentables.c */
+#include "opera_dsp_tables_i.h"
+#endif
+
+static THREAD_LOCAL CACHE_ALIGNED dsp_t DSP;
 
 int
 fastrand(void)
@@ -493,7 +665,7 @@ dsp_operand_load1(void)
     case 1:
     case 2:
     case 3:
-      op = dsp_read(DSP.REGCONV[DSP.REGi][operand.r3of.R3] ^ DSP.RBASEx4);
+      op = dsp_read(REGCONV[DSP.REGi][operand.r3of.R3] ^ DSP.RBASEx4);
       if(operand.r3of.R3_DI) /* ??? */
         return dsp_read(op);
       return op;
@@ -506,7 +678,7 @@ dsp_operand_load1(void)
       return op;
     case 5:
       // if(operand.r2of.NUMREGS) ignore... It's right?
-      op = dsp_read(DSP.REGCONV[DSP.REGi][operand.r2of.R1] ^ DSP.RBASEx4);
+      op = dsp_read(REGCONV[DSP.REGi][operand.r2of.R1] ^ DSP.RBASEx4);
       if(operand.r2of.R1_DI)
         return dsp_read(op);
       return op;
@@ -552,18 +724,18 @@ dsp_operand_load(int requests_)
         case 1:
         case 2:
         case 3:
-          ops[op_cnt] = dsp_read(DSP.REGCONV[DSP.REGi][operand.r3of.R3] ^ DSP.RBASEx4);
+          ops[op_cnt] = dsp_read(REGCONV[DSP.REGi][operand.r3of.R3] ^ DSP.RBASEx4);
           if(operand.r3of.R3_DI)
             ops[op_cnt] = dsp_read(ops[op_cnt]);
           op_cnt++;
 
-          ops[op_cnt] = dsp_read(DSP.REGCONV[DSP.REGi][operand.r3of.R2] ^ DSP.RBASEx4);
+          ops[op_cnt] = dsp_read(REGCONV[DSP.REGi][operand.r3of.R2] ^ DSP.RBASEx4);
           if(operand.r3of.R2_DI)
             ops[op_cnt] = dsp_read(ops[op_cnt]);
           op_cnt++;
 
           /* only R1 can be WRITEBACK */
-          DSP.flags.WRITEBACK = (DSP.REGCONV[DSP.REGi][operand.r3of.R1] ^ DSP.RBASEx4);
+          DSP.flags.WRITEBACK = (REGCONV[DSP.REGi][operand.r3of.R1] ^ DSP.RBASEx4);
           ops[op_cnt] = dsp_read(DSP.flags.WRITEBACK);
           if(operand.r3of.R1_DI)
             ops[op_cnt] = dsp_read(ops[op_cnt]);
@@ -584,7 +756,7 @@ dsp_operand_load(int requests_)
           //regged 1/2 format
           if(operand.r2of.NUMREGS)
             {
-              DSP.flags.WRITEBACK = DSP.REGCONV[DSP.REGi][operand.r2of.R2] ^ DSP.RBASEx4;
+              DSP.flags.WRITEBACK = REGCONV[DSP.REGi][operand.r2of.R2] ^ DSP.RBASEx4;
               if(operand.r2of.R2_DI)
                 DSP.flags.WRITEBACK = dsp_read(DSP.flags.WRITEBACK);
               ops[op_cnt] = dsp_read(DSP.flags.WRITEBACK);
@@ -594,7 +766,7 @@ dsp_operand_load(int requests_)
                 GWRITEBACK = DSP.flags.WRITEBACK;
             }
 
-          DSP.flags.WRITEBACK = DSP.REGCONV[DSP.REGi][operand.r2of.R1] ^ DSP.RBASEx4;
+          DSP.flags.WRITEBACK = REGCONV[DSP.REGi][operand.r2of.R1] ^ DSP.RBASEx4;
           if(operand.r2of.R1_DI)
             DSP.flags.WRITEBACK = dsp_read(DSP.flags.WRITEBACK);
           ops[op_cnt] = dsp_read(DSP.flags.WRITEBACK);
@@ -644,161 +816,19 @@ dsp_operand_load(int requests_)
     }
 }
 
-static
-INLINE
-uint16_t
-dsp_register_base(uint32_t reg_)
-{
-  uint8_t x;
-  uint8_t y;
-  uint8_t twi;
-
-  reg_ &= 0x0000000F;
-  x     = ((reg_ >> 2) & 1);
-  y     = ((reg_ >> 3) & 1);
-
-  switch(DSP.flags.RMAP)
-    {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
-      twi = x;
-      break;
-    case 4:
-      twi = y;
-      break;
-    case 5:
-      twi = !y;
-      break;
-    case 6:
-      twi = x & y;
-      break;
-    case 7:
-      twi = x | y;
-      break;
-    }
-
-  return ((reg_ & 7) | (twi << 8) | (reg_ >> 3) << 9);
-}
-
 void
 opera_dsp_init(void)
 {
   uint32_t i;
-  int32_t a,c;
-  ITAG_t inst;
-
-  DSP.g_seed = 0xa5a5a5a5;
-  for(a = 0; a < 16; a++)
-    {
-      for(c = 0; c < 8; c++)
-        {
-          DSP.flags.RMAP    = c;
-          DSP.REGCONV[c][a] = dsp_register_base(a);
-        }
-    }
-
-  for(inst.raw = 0; inst.raw < 0x8000; inst.raw++)
-    {
-      DSP.flags.req.raw = 0;
-
-      if(inst.aif.BS == 0x8)
-        DSP.flags.req.rq.BS = 1;
-
-      switch(inst.aif.MUXA)
-        {
-        case 3:
-          DSP.flags.req.rq.MULT1 = 1;
-          DSP.flags.req.rq.MULT2 = inst.aif.M2SEL;
-          break;
-        case 1:
-          DSP.flags.req.rq.ALU1 = 1;
-          break;
-        case 2:
-          DSP.flags.req.rq.ALU2 = 1;
-          break;
-        }
-
-      switch(inst.aif.MUXB)
-        {
-        case 1:
-          DSP.flags.req.rq.ALU1 = 1;
-          break;
-        case 2:
-          DSP.flags.req.rq.ALU2 = 1;
-          break;
-        case 3:
-          DSP.flags.req.rq.MULT1 = 1;
-          DSP.flags.req.rq.MULT2 = inst.aif.M2SEL;
-          break;
-        }
-
-      DSP.INSTTRAS[inst.raw].req.raw = DSP.flags.req.raw;
-      DSP.INSTTRAS[inst.raw].BS      = (inst.aif.BS | ((inst.aif.ALU & 8) << (4 - 3)));
-    }
-
-  {
-    int MD1, MD2, MD3;
-    int STAT0, STAT1;
-    int NSTAT0, NSTAT1;
-    int TDCARE0, TDCARE1;
-    int RDCARE;
-    int MD12S;
-    int SUPER0, SUPER1;
-    int ALLZERO, NALLZERO;
-    int SDS;
-    int NVTest;
-    int TMPCS;
-    int CZTest, XactTest;
-    int MD3S;
-    int fExact;
-
-    dsp_alu_flags_t flags;
-
-    for(inst.raw = 0xA000; inst.raw <= 0xFFFF; inst.raw += 1024)
-      for(flags.zero = 0; flags.zero < 2; flags.zero++)
-        for(flags.negative = 0; flags.negative < 2; flags.negative++)
-          for(flags.carry = 0; flags.carry < 2; flags.carry++)
-            for(flags.overflow = 0; flags.overflow < 2; flags.overflow++)
-              for(fExact = 0; fExact < 2; fExact++)
-                {
-                  MD1 = !inst.branch.MODE1 && inst.branch.MODE0;
-                  MD2 = inst.branch.MODE1 && !inst.branch.MODE0;
-                  MD3 = inst.branch.MODE1 && inst.branch.MODE0;
-
-                  STAT0  = (inst.branch.FLAGSEL && flags.carry) || (!inst.branch.FLAGSEL && flags.negative);
-                  STAT1  = (inst.branch.FLAGSEL && flags.zero) || (!inst.branch.FLAGSEL && flags.overflow);
-                  NSTAT0 = STAT0 != MD2;
-                  NSTAT1 = STAT1 != MD2;
-
-                  TDCARE1 = !inst.branch.FLAGM1 || (inst.branch.FLAGM1 && NSTAT0);
-                  TDCARE0 = !inst.branch.FLAGM0 || (inst.branch.FLAGM0 && NSTAT1);
-
-                  RDCARE = !inst.branch.FLAGM1 && !inst.branch.FLAGM0;
-
-                  MD12S = TDCARE1 && TDCARE0 && (inst.branch.MODE1!=inst.branch.MODE0) && !RDCARE;
-
-                  SUPER0 = MD1 && !inst.branch.FLAGSEL && RDCARE;
-                  SUPER1 = MD1 && inst.branch.FLAGSEL &&  RDCARE;
-
-                  ALLZERO  = SUPER0 && flags.zero && fExact;
-                  NALLZERO = SUPER1 && !(flags.zero && fExact);
+#if IS_BIG_ENDIAN && defined(OPERA_MULTI_INSTANCE)
+  static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
 
-                  SDS = ALLZERO || NALLZERO;
-
-                  NVTest   = ((((flags.negative != flags.overflow) ||
-                                (flags.zero && inst.branch.FLAGM0)) != inst.branch.FLAGM1) &&
-                              !inst.branch.FLAGSEL);
-                  TMPCS    = flags.carry && !flags.zero;
-                  CZTest   = (TMPCS != inst.branch.FLAGM0) && inst.branch.FLAGSEL && !inst.branch.FLAGM1;
-                  XactTest = (fExact != inst.branch.FLAGM0) && inst.branch.FLAGSEL && inst.branch.FLAGM1;
-
-                  MD3S = ((NVTest || CZTest || XactTest) && MD3);
+  pthread_once(&tables_once,dsp_tables_init);
+#elif IS_BIG_ENDIAN
+  dsp_tables_init();
+#endif
 
-                  DSP.BRCONDTAB[inst.br.bits][fExact+((flags.raw*0x10080402)>>24)] = (MD12S || MD3S || SDS);
-                }
-  }
+  DSP.g_seed = 0xa5a5a5a5;
 
   DSP.flags.Running = FALSE;
   DSP.flags.GenFIQ  = FALSE;
@@ -852,6 +882,7 @@ opera_dsp_loop(void)
           ITAG_t inst;
 
           inst.raw = DSP.NMem[DSP.dregs.PC++];
+          OPERA_PERF_COUNT(OPERA_PERF_DSP_INSNS,1);
           if(inst.aif.PAD)
             { // Control instruction
               switch((inst.raw >> 7) & 0xFF)
@@ -933,7 +964,7 @@ opera_dsp_loop(void)
                     uint16_t addr;
 
                     op   = dsp_operand_load1();
-                    addr = DSP.REGCONV[DSP.REGi][inst.r2of.R1] ^ DSP.RBASEx4;
+                    addr = REGCONV[DSP.REGi][inst.r2of.R1] ^ DSP.RBASEx4;
                     if(inst.r2of.R1_DI)
                       addr = dsp_read(addr);
                     dsp_write(addr,op);
@@ -967,7 +998,7 @@ opera_dsp_loop(void)
                   }
                   break;
                 default: /* condition branch */
-                  if(1 & DSP.BRCONDTAB[inst.br.bits][fExact+((flags.raw*0x10080402)>>24)])
+                  if(1 & BRCONDTAB[inst.br.bits][fExact+((flags.raw*0x10080402)>>24)])
                     DSP.dregs.PC = inst.cif.BCH_ADDR;
                   break;
                 }
@@ -975,8 +1006,8 @@ opera_dsp_loop(void)
           else
             {
               /* ALU instruction */
-              DSP.flags.req.raw = DSP.INSTTRAS[inst.raw].req.raw;
-              DSP.flags.BS      = DSP.INSTTRAS[inst.raw].BS;
+              DSP.flags.req.raw = INSTTRAS[inst.raw].req.raw;
+              DSP.flags.BS      = INSTTRAS[inst.raw].BS;
 
               dsp_operand_load(inst.aif.NUMOPS);
 
@@ -1228,6 +1259,8 @@ opera_dsp_loop(void)
         DSP.dregs.DSPPCNT += DSP.dregs.DSPPRLD;
     }
 
+  OPERA_PERF_COUNT(OPERA_PERF_DSP_SAMPLES,1);
+
   return ((DSP.IMem[0x3FF] << 16) | DSP.IMem[0x3FE]);
 }
 
@@ -0,0 +1,2233 @@
+/* generated by tools/opera-gentables dsp, do not edit */
+
+#ifndef LIBOPERA_DSP_TABLES_I_H_INCLUDED
+#define LIBOPERA_DSP_TABLES_I_H_INCLUDED
+
+#if IS_BIG_ENDIAN
+#error "little endian bitfield layouts, build the tables at init"
+#endif
+
+/* ALU operand requests and barrel shift per instruction word */
+static const INSTTRAS_t INSTTRAS[0x8000] =
+  {
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},0},{{20},1},{{20},2},{{20},3},{{20},4},{{20},5},{{20},6},{{20},7},{{21},8},{{20},9},{{20},10},{{20},11},{{20},12},{{20},13},{{20},14},{{20},15},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{20},16},{{20},17},{{20},18},{{20},19},{{20},20},{{20},21},{{20},22},{{20},23},{{21},24},{{20},25},{{20},26},{{20},27},{{20},28},{{20},29},{{20},30},{{20},31},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},0},{{18},1},{{18},2},{{18},3},{{18},4},{{18},5},{{18},6},{{18},7},{{19},8},{{18},9},{{18},10},{{18},11},{{18},12},{{18},13},{{18},14},{{18},15},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{18},16},{{18},17},{{18},18},{{18},19},{{18},20},{{18},21},{{18},22},{{18},23},{{19},24},{{18},25},{{18},26},{{18},27},{{18},28},{{18},29},{{18},30},{{18},31},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},0},{{16},1},{{16},2},{{16},3},{{16},4},{{16},5},{{16},6},{{16},7},{{17},8},{{16},9},{{16},10},{{16},11},{{16},12},{{16},13},{{16},14},{{16},15},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{16},16},{{16},17},{{16},18},{{16},19},{{16},20},{{16},21},{{16},22},{{16},23},{{17},24},{{16},25},{{16},26},{{16},27},{{16},28},{{16},29},{{16},30},{{16},31},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},0},{{0},1},{{0},2},{{0},3},{{0},4},{{0},5},{{0},6},{{0},7},{{1},8},{{0},9},{{0},10},{{0},11},{{0},12},{{0},13},{{0},14},{{0},15},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{0},16},{{0},17},{{0},18},{{0},19},{{0},20},{{0},21},{{0},22},{{0},23},{{1},24},{{0},25},{{0},26},{{0},27},{{0},28},{{0},29},{{0},30},{{0},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},0},{{4},1},{{4},2},{{4},3},{{4},4},{{4},5},{{4},6},{{4},7},{{5},8},{{4},9},{{4},10},{{4},11},{{4},12},{{4},13},{{4},14},{{4},15},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{4},16},{{4},17},{{4},18},{{4},19},{{4},20},{{4},21},{{4},22},{{4},23},{{5},24},{{4},25},{{4},26},{{4},27},{{4},28},{{4},29},{{4},30},{{4},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},0},{{6},1},{{6},2},{{6},3},{{6},4},{{6},5},{{6},6},{{6},7},{{7},8},{{6},9},{{6},10},{{6},11},{{6},12},{{6},13},{{6},14},{{6},15},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{6},16},{{6},17},{{6},18},{{6},19},{{6},20},{{6},21},{{6},22},{{6},23},{{7},24},{{6},25},{{6},26},{{6},27},{{6},28},{{6},29},{{6},30},{{6},31},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},0},{{2},1},{{2},2},{{2},3},{{2},4},{{2},5},{{2},6},{{2},7},{{3},8},{{2},9},{{2},10},{{2},11},{{2},12},{{2},13},{{2},14},{{2},15},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{2},16},{{2},17},{{2},18},{{2},19},{{2},20},{{2},21},{{2},22},{{2},23},{{3},24},{{2},25},{{2},26},{{2},27},{{2},28},{{2},29},{{2},30},{{2},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},0},{{28},1},{{28},2},{{28},3},{{28},4},{{28},5},{{28},6},{{28},7},{{29},8},{{28},9},{{28},10},{{28},11},{{28},12},{{28},13},{{28},14},{{28},15},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{28},16},{{28},17},{{28},18},{{28},19},{{28},20},{{28},21},{{28},22},{{28},23},{{29},24},{{28},25},{{28},26},{{28},27},{{28},28},{{28},29},{{28},30},{{28},31},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},0},{{26},1},{{26},2},{{26},3},{{26},4},{{26},5},{{26},6},{{26},7},{{27},8},{{26},9},{{26},10},{{26},11},{{26},12},{{26},13},{{26},14},{{26},15},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{26},16},{{26},17},{{26},18},{{26},19},{{26},20},{{26},21},{{26},22},{{26},23},{{27},24},{{26},25},{{26},26},{{26},27},{{26},28},{{26},29},{{26},30},{{26},31},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},0},{{24},1},{{24},2},{{24},3},{{24},4},{{24},5},{{24},6},{{24},7},{{25},8},{{24},9},{{24},10},{{24},11},{{24},12},{{24},13},{{24},14},{{24},15},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31},
+    {{24},16},{{24},17},{{24},18},{{24},19},{{24},20},{{24},21},{{24},22},{{24},23},{{25},24},{{24},25},{{24},26},{{24},27},{{24},28},{{24},29},{{24},30},{{24},31}
+  };
+
+/* register file address per RMAP and register select */
+static const uint16_t REGCONV[8][16] =
+  {
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0104,0x0105,0x0106,0x0107,
+      0x0200,0x0201,0x0202,0x0203,0x0304,0x0305,0x0306,0x0307
+    },
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0104,0x0105,0x0106,0x0107,
+      0x0200,0x0201,0x0202,0x0203,0x0304,0x0305,0x0306,0x0307
+    },
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0104,0x0105,0x0106,0x0107,
+      0x0200,0x0201,0x0202,0x0203,0x0304,0x0305,0x0306,0x0307
+    },
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0104,0x0105,0x0106,0x0107,
+      0x0200,0x0201,0x0202,0x0203,0x0304,0x0305,0x0306,0x0307
+    },
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,
+      0x0300,0x0301,0x0302,0x0303,0x0304,0x0305,0x0306,0x0307
+    },
+    {
+      0x0100,0x0101,0x0102,0x0103,0x0104,0x0105,0x0106,0x0107,
+      0x0200,0x0201,0x0202,0x0203,0x0204,0x0205,0x0206,0x0207
+    },
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,
+      0x0200,0x0201,0x0202,0x0203,0x0304,0x0305,0x0306,0x0307
+    },
+    {
+      0x0000,0x0001,0x0002,0x0003,0x0104,0x0105,0x0106,0x0107,
+      0x0300,0x0301,0x0302,0x0303,0x0304,0x0305,0x0306,0x0307
+    }
+  };
+
+/* branch taken per condition bits and ALU flags */
+static const uint8_t BRCONDTAB[32][32] =
+  {
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1
+    },
+    {
+      0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+      0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1
+    },
+    {
+      0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+      0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,
+      0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1
+    },
+    {
+      1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+      1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    },
+    {
+      0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,
+      0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,
+      1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0
+    },
+    {
+      1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+      1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0
+    },
+    {
+      1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,
+      1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,
+      1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0
+    },
+    {
+      1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,1,1,0,0,1,1,1,1,0,0,1,1,0,0,
+      0,0,1,1,0,0,1,1,1,1,0,0,1,1,0,0
+    },
+    {
+      0,0,1,1,0,0,1,1,1,1,0,0,1,1,0,0,
+      1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    },
+    {
+      1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,
+      1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1
+    },
+    {
+      1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    },
+    {
+      1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,
+      1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    },
+    {
+      0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+      0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1
+    },
+    {
+      1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+      1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0
+    }
+  };
+
+#endif /* LIBOPERA_DSP_TABLES_I_H_INCLUDED */
@@ -0,0 +1,179 @@
+#include "opera_arena.h"
+#include "opera_arm.h"
+#include "opera_cpu.h"
+#include "opera_hires.h"
+#include "thread_local.h"
+
+#include <string.h>
+
+THREAD_LOCAL opera_hires_t OPERA_HIRES = {0};
+
+/*
+  Seeds the page's sub-pixel planes from VRAM before its first hires
+  write. The surface is carved from the arena on first use so lores
+  sessions never touch it. Returns -1 if it can't be, callers then
+  fall back to plane 0 only.
+*/
+int
+opera_hires_detail(const uint32_t page_)
+{
+  uint32_t i;
+  uint32_t off;
+  const uint8_t *vram;
+
+  if(OPERA_HIRES.detailed[page_])
+    return 0;
+
+  if(OPERA_HIRES.planes == NULL)
+    {
+      OPERA_HIRES.planes = opera_arena_alloc(3 * OPERA_HIRES_VRAM_SIZE);
+      if(OPERA_HIRES.planes == NULL)
+        return -1;
+    }
+
+  vram = opera_arm_vram_get();
+  off  = (page_ << OPERA_HIRES_PAGE_SHIFT);
+  for(i = 1; i <= 3; i++)
+    memcpy(opera_hires_plane(i,off),&vram[off],OPERA_HIRES_PAGE_SIZE);
+
+  OPERA_HIRES.detailed[page_] = 1;
+
+  return 0;
+}
+
+void
+opera_hires_flatten(const uint32_t addr_,
+                    const uint32_t size_)
+{
+  uint32_t off;
+  uint32_t page;
+  uint32_t last;
+
+  off = opera_hires_offset(addr_);
+  if((size_ == 0) || (off == OPERA_HIRES_VRAM_SIZE))
+    return;
+
+  page = (off >> OPERA_HIRES_PAGE_SHIFT);
+  last = ((off + size_ - 1) >> OPERA_HIRES_PAGE_SHIFT);
+  if(last >= OPERA_HIRES_PAGE_COUNT)
+    last = (OPERA_HIRES_PAGE_COUNT - 1);
+
+  for(; page <= last; page++)
+    OPERA_HIRES.detailed[page] = 0;
+}
+
+static
+void
+hires_copy_planes(const uint32_t doff_,
+                  const uint32_t soff_,
+                  const uint32_t mask_,
+                  const uint32_t size_)
+{
+  uint32_t i;
+  const uint8_t *src;
+  const uint8_t *vram;
+
+  vram = opera_arm_vram_get();
+  for(i = 1; i <= 3; i++)
+    {
+      src = (opera_hires_is_detailed(soff_) ?
+             opera_hires_plane(i,soff_) :
+             &vram[soff_]);
+      if(mask_)
+        OPERA_CPU.copy32_mask((uint32_t*)opera_hires_plane(i,doff_),
+                              (const uint32_t*)src,
+                              mask_,
+                              (size_ >> 2));
+      else
+        memmove(opera_hires_plane(i,doff_),src,size_);
+    }
+}
+
+/*
+  Carries a VRAM to VRAM copy's sub-pixels along, copy32_mask style
+  for a non zero mask_. Must run before VRAM itself is copied since
+  destination pages gaining detail are seeded from it. Offsets are
+  word aligned and the ranges inside VRAM.
+*/
+static
+void
+hires_copy(uint32_t       doff_,
+           uint32_t       soff_,
+           const uint32_t mask_,
+           uint32_t       size_)
+{
+  uint32_t n;
+  uint32_t page;
+  int      detailed;
+
+  while(size_)
+    {
+      n = size_;
+      if(n > (OPERA_HIRES_PAGE_SIZE - (doff_ & (OPERA_HIRES_PAGE_SIZE - 1))))
+        n = (OPERA_HIRES_PAGE_SIZE - (doff_ & (OPERA_HIRES_PAGE_SIZE - 1)));
+      if(n > (OPERA_HIRES_PAGE_SIZE - (soff_ & (OPERA_HIRES_PAGE_SIZE - 1))))
+        n = (OPERA_HIRES_PAGE_SIZE - (soff_ & (OPERA_HIRES_PAGE_SIZE - 1)));
+
+      page     = (doff_ >> OPERA_HIRES_PAGE_SHIFT);
+      detailed = opera_hires_is_detailed(soff_);
+      if(!detailed && !mask_ && (n == OPERA_HIRES_PAGE_SIZE))
+        {
+          OPERA_HIRES.detailed[page] = 0;
+        }
+      else if(detailed || OPERA_HIRES.detailed[page])
+        {
+          /* planes exist once any page is detailed so this can't fail */
+          opera_hires_detail(page);
+          hires_copy_planes(doff_,soff_,mask_,n);
+        }
+
+      doff_ += n;
+      soff_ += n;
+      size_ -= n;
+    }
+}
+
+/*
+  SPORT page copies. The destination takes on the source's detail
+  where there is any rather than being flattened.
+*/
+void
+opera_hires_copy(const uint32_t dst_,
+                 const uint32_t src_,
+                 const uint32_t size_)
+{
+  opera_hires_copy_mask(dst_,src_,0,size_);
+}
+
+void
+opera_hires_copy_mask(const uint32_t dst_,
+                      const uint32_t src_,
+                      const uint32_t mask_,
+                      const uint32_t size_)
+{
+  uint32_t doff;
+  uint32_t soff;
+
+  doff = opera_hires_offset(dst_);
+  soff = opera_hires_offset(src_);
+  if((doff == OPERA_HIRES_VRAM_SIZE) ||
+     (soff == OPERA_HIRES_VRAM_SIZE) ||
+     (doff == soff))
+    return;
+
+  hires_copy(doff,soff,mask_,size_);
+}
+
+void
+opera_hires_reset(void)
+{
+  memset(OPERA_HIRES.detailed,0,sizeof(OPERA_HIRES.detailed));
+}
+
+/* the surface itself is released with the arena */
+void
+opera_hires_destroy(void)
+{
+  opera_hires_reset();
+  OPERA_HIRES.planes = NULL;
+}
@@ -0,0 +1,133 @@
+#ifndef LIBOPERA_HIRES_H_INCLUDED
+#define LIBOPERA_HIRES_H_INCLUDED
+
+#include "extern_c.h"
+#include "inline.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+
+/*
+  Host side surface for the 2x2 hires CEL output. The guest keeps its
+  single VRAM image which doubles as sub-pixel plane 0. Planes 1-3
+  ((1,0), (0,1) and (1,1)) live here and only exist for VRAM pages a
+  hires CEL has drawn into ("detailed" pages). All sub-pixels of a
+  flat page are equal to VRAM so guest writes only need mirroring into
+  detailed pages and whole page writes (SPORT fills, state loads)
+  simply flatten them again. SPORT copies carry the source's detail.
+*/
+
+#define OPERA_HIRES_VRAM_ADDR  0x00200000
+#define OPERA_HIRES_VRAM_SIZE  (1024 * 1024)
+#define OPERA_HIRES_PAGE_SHIFT 10
+#define OPERA_HIRES_PAGE_SIZE  (1 << OPERA_HIRES_PAGE_SHIFT)
+#define OPERA_HIRES_PAGE_COUNT (OPERA_HIRES_VRAM_SIZE >> OPERA_HIRES_PAGE_SHIFT)
+
+EXTERN_C_BEGIN
+
+struct opera_hires_s
+{
+  uint8_t *planes;
+  uint8_t  detailed[OPERA_HIRES_PAGE_COUNT];
+};
+
+typedef struct opera_hires_s opera_hires_t;
+
+extern THREAD_LOCAL opera_hires_t OPERA_HIRES;
+
+int  opera_hires_detail(const uint32_t page_);
+void opera_hires_flatten(const uint32_t addr_, const uint32_t size_);
+void opera_hires_copy(const uint32_t dst_, const uint32_t src_, const uint32_t size_);
+void opera_hires_copy_mask(const uint32_t dst_, const uint32_t src_,
+                           const uint32_t mask_, const uint32_t size_);
+void opera_hires_reset(void);
+void opera_hires_destroy(void);
+
+/* VRAM relative offset, OPERA_HIRES_VRAM_SIZE if outside VRAM */
+static
+FORCEINLINE
+uint32_t
+opera_hires_offset(const uint32_t addr_)
+{
+  uint32_t off;
+
+  off = (addr_ - OPERA_HIRES_VRAM_ADDR);
+  if(off >= OPERA_HIRES_VRAM_SIZE)
+    return OPERA_HIRES_VRAM_SIZE;
+
+  return off;
+}
+
+static
+FORCEINLINE
+int
+opera_hires_is_detailed(const uint32_t off_)
+{
+  return OPERA_HIRES.detailed[(off_ & (OPERA_HIRES_VRAM_SIZE - 1)) >> OPERA_HIRES_PAGE_SHIFT];
+}
+
+/* plane_ in 1..3, off_ a VRAM offset within a detailed page */
+static
+FORCEINLINE
+uint8_t*
+opera_hires_plane(const uint32_t plane_,
+                  const uint32_t off_)
+{
+  return &OPERA_HIRES.planes[((plane_ - 1) * OPERA_HIRES_VRAM_SIZE) +
+                             (off_ & (OPERA_HIRES_VRAM_SIZE - 1))];
+}
+
+static
+FORCEINLINE
+void
+opera_hires_write8(const uint32_t addr_,
+                   const uint8_t  val_)
+{
+  uint32_t off;
+
+  off = opera_hires_offset(addr_);
+  if((off == OPERA_HIRES_VRAM_SIZE) || !opera_hires_is_detailed(off))
+    return;
+
+  *opera_hires_plane(1,off) = val_;
+  *opera_hires_plane(2,off) = val_;
+  *opera_hires_plane(3,off) = val_;
+}
+
+static
+FORCEINLINE
+void
+opera_hires_write16(const uint32_t addr_,
+                    const uint16_t val_)
+{
+  uint32_t off;
+
+  off = opera_hires_offset(addr_);
+  if((off == OPERA_HIRES_VRAM_SIZE) || !opera_hires_is_detailed(off))
+    return;
+
+  *(uint16_t*)opera_hires_plane(1,off) = val_;
+  *(uint16_t*)opera_hires_plane(2,off) = val_;
+  *(uint16_t*)opera_hires_plane(3,off) = val_;
+}
+
+static
+FORCEINLINE
+void
+opera_hires_write32(const uint32_t addr_,
+                    const uint32_t val_)
+{
+  uint32_t off;
+
+  off = opera_hires_offset(addr_);
+  if((off == OPERA_HIRES_VRAM_SIZE) || !opera_hires_is_detailed(off))
+    return;
+
+  *(uint32_t*)opera_hires_plane(1,off) = val_;
+  *(uint32_t*)opera_hires_plane(2,off) = val_;
+  *(uint32_t*)opera_hires_plane(3,off) = val_;
+}
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_HIRES_H_INCLUDED */
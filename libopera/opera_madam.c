@@ -29,6 +29,7 @@
 */
 
 #include "bool.h"
+#include "cache_aligned.h"
 #include "endianness.h"
 #include "hack_flags.h"
 #include "inline.h"
@@ -36,16 +37,24 @@
 #include "opera_bitop.h"
 #include "opera_clio.h"
 #include "opera_core.h"
+#include "opera_dirty.h"
+#include "opera_hires.h"
 #include "opera_madam.h"
 #include "opera_pbus.h"
+#include "opera_perf.h"
 #include "opera_vdlp.h"
+#include "thread_local.h"
 
 #include <math.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
-static struct BitReaderBig bitoper;
+#if IS_BIG_ENDIAN && defined(OPERA_MULTI_INSTANCE)
+#include <pthread.h>
+#endif
+
+static THREAD_LOCAL struct BitReaderBig bitoper;
 
 /* === CCB control word flags === */
 #define CCB_SKIP        0x80000000
@@ -394,9 +403,9 @@ typedef struct madam_s madam_t;
 #define MADAM_ID_GREEN_HARDWARE 0x01020000
 #define MADAM_ID_GREEN_SOFTWARE 0x01020001
 
-static madam_t MADAM;
-static int KPRINT  = 0;
-static int ME_MODE = ME_MODE_HARDWARE;
+static THREAD_LOCAL CACHE_ALIGNED madam_t MADAM;
+static THREAD_LOCAL int KPRINT  = 0;
+static THREAD_LOCAL int ME_MODE = ME_MODE_HARDWARE;
 
 void
 opera_madam_kprint_enable(void)
@@ -471,14 +480,14 @@ static void     DMAPBus(void);
 #define INT1220(a)   ((int32_t)(a)>>20)
 #define INT1220up(a) ((int32_t)((a)+(1<<19))>>20)
 
-static struct
+static THREAD_LOCAL struct
 {
   uint32_t plutaCCBbits;
   uint32_t pixelBitsMask;
   int      tmask;
 } pdec;
 
-static struct
+static THREAD_LOCAL struct
 {
   uint32_t pmode;
   uint32_t pmodeORmask;
@@ -486,38 +495,97 @@ static struct
   int      Transparent;
 } pproj;
 
-static uint8_t  *DRAM;
-static uint32_t  retuval;
-static uint32_t  BITADDR;
-static uint32_t  CCBFLAGS;
-static uint32_t  PIXC;
-static uint32_t  PRE0;
-static uint32_t  PRE1;
-static uint32_t  TARGETPROJ;
-static uint32_t  SRCDATA;
-static int32_t   SPRWI;
-static int32_t   SPRHI;
-static uint32_t  PLUTF;
-static uint32_t  PDATF;
-static uint32_t  NCCBF;
-static uint32_t  PXOR1;
-static uint32_t  PXOR2;
+static THREAD_LOCAL uint8_t  *DRAM;
+static THREAD_LOCAL uint32_t  retuval;
+static THREAD_LOCAL uint32_t  BITADDR;
+static THREAD_LOCAL uint32_t  CCBFLAGS;
+static THREAD_LOCAL uint32_t  PIXC;
+static THREAD_LOCAL uint32_t  PRE0;
+static THREAD_LOCAL uint32_t  PRE1;
+static THREAD_LOCAL uint32_t  TARGETPROJ;
+static THREAD_LOCAL uint32_t  SRCDATA;
+static THREAD_LOCAL int32_t   SPRWI;
+static THREAD_LOCAL int32_t   SPRHI;
+static THREAD_LOCAL uint32_t  PLUTF;
+static THREAD_LOCAL uint32_t  PDATF;
+static THREAD_LOCAL uint32_t  NCCBF;
+static THREAD_LOCAL uint32_t  PXOR1;
+static THREAD_LOCAL uint32_t  PXOR2;
 
 static uint32_t const BPP[8] = {1,1,2,4,6,8,16,1};
 
-static uint8_t PSCALAR[8][4][32];
-
+#if IS_BIG_ENDIAN
+/*
+  The generated tables are indexed through little endian bitfield
+  layouts so big endian hosts build them at init instead. Shared
+  between instances, see thread_local.h
+*/
+static uint8_t  PSCALAR[8][4][32];
 static uint16_t MAPu8b[256+64];
 static uint16_t MAPc8bAMV[256+64];
 static uint16_t MAPc16bAMV[8*8*8+64];
 
-static uint32_t bpp;
-static int32_t  pixcount;
-static uint32_t type;
-static uint32_t offsetl;
-static uint32_t offset;
-static uint32_t eor;
-static int32_t  nrows;
+static
+int32_t
+PDV(const int32_t x_)
+{
+  return (((x_ - 1) & 3) + 1);
+}
+
+static
+void
+madam_tables_init(void)
+{
+  int32_t i;
+  int32_t j;
+  int32_t n;
+
+  for(i = 0; i < 32; i++)
+    for(j = 0; j < 8; j++)
+      for(n = 0; n < 4; n++)
+        PSCALAR[j][n][i] = ((i * (j + 1)) >> PDV(n));
+
+  for(i = 0; i < 256; i++)
+    {
+      pdeco_t  pix1;
+      pdeco_t  pix2;
+      uint16_t pres;
+      uint16_t resamv;
+
+      pix1.raw     = i;
+      pix2.raw     = 0;
+      pix2.r16b.b  = (pix1.u8b.b << 3) + (pix1.u8b.b << 1) + (pix1.u8b.b >> 1);
+      pix2.r16b.g  = (pix1.u8b.g << 2) + (pix1.u8b.g >> 1);
+      pix2.r16b.r  = (pix1.u8b.r << 2) + (pix1.u8b.r >> 1);
+      pres         = pix2.raw;
+      pres        &= 0x7fff;
+      MAPu8b[i]    = pres;
+
+      resamv       = ((pix1.c8b.m << 1) + pix1.c8b.mpw);
+      resamv       = ((resamv << 6) + (resamv << 3) + resamv);
+      MAPc8bAMV[i] = resamv;
+    }
+
+  for(i = 0; i < (8*8*8); i++)
+    {
+      pdeco_t pix1;
+
+      pix1.raw = i << 5;
+      MAPc16bAMV[i] = ((pix1.c16b.mr << 6) + (pix1.c16b.mg << 3) + pix1.c16b.mb);
+    }
+}
+#else
+/* PSCALAR and the MAP* pixel decode tables: see tools/opera_gentables.c */
+#include "opera_madam_tables_i.h"
+#endif
+
+static THREAD_LOCAL uint32_t bpp;
+static THREAD_LOCAL int32_t  pixcount;
+static THREAD_LOCAL uint32_t type;
+static THREAD_LOCAL uint32_t offsetl;
+static THREAD_LOCAL uint32_t offset;
+static THREAD_LOCAL uint32_t eor;
+static THREAD_LOCAL int32_t  nrows;
 
 //CelEngine STATBits
 #define STATBITS	MADAM.mregs[0x28]
@@ -547,15 +615,6 @@ static int32_t  nrows;
 #define	ENGBFETCH	MADAM.mregs[0x5b8]
 #define ENGBLEN		MADAM.mregs[0x5bc]
 
-static
-INLINE
-const
-int32_t
-PDV(const int32_t x_)
-{
-  return (((x_ - 1) & 3) + 1);
-}
-
 static
 INLINE
 const
@@ -633,10 +692,10 @@ opera_madam_peek(uint32_t addr_)
 #define MV2 ((int64_t)(int32_t)MADAM.mregs[0x648])
 #define MV3 ((int64_t)(int32_t)MADAM.mregs[0x64C])
 
-static int64_t tmpMO0;
-static int64_t tmpMO1;
-static int64_t tmpMO2;
-static int64_t tmpMO3;
+static THREAD_LOCAL int64_t tmpMO0;
+static THREAD_LOCAL int64_t tmpMO1;
+static THREAD_LOCAL int64_t tmpMO2;
+static THREAD_LOCAL int64_t tmpMO3;
 
 #define Nfrac16 (((int64_t)MADAM.mregs[0x680]<<32) | \
                  (uint32_t)MADAM.mregs[0x684])
@@ -818,33 +877,33 @@ opera_madam_poke(uint32_t addr_,
     }
 }
 
-static uint32_t Flag;
-
-static float HDDX;
-static float HDDY;
-static float HDX;
-static float HDY;
-static float VDX;
-static float VDY;
-
-static int32_t  HDDX1616;
-static int32_t  HDDY1616;
-static int32_t  HDX1616;
-static int32_t  HDY1616;
-static int32_t  VDX1616;
-static int32_t  VDY1616;
-static int32_t  XPOS1616;
-static int32_t  YPOS1616;
-static int32_t  HDX1616_2;
-static int32_t  HDY1616_2;
-static uint32_t CEL_ORIGIN_VH_VALUE;
-static int8_t   TEXEL_FUN_NUMBER;
-static int32_t  TEXTURE_WI_START;
-static int32_t  TEXTURE_HI_START;
-static int32_t  TEXEL_INCX;
-static int32_t  TEXEL_INCY;
-static int32_t  TEXTURE_WI_LIM;
-static int32_t  TEXTURE_HI_LIM;
+static THREAD_LOCAL uint32_t Flag;
+
+static THREAD_LOCAL float HDDX;
+static THREAD_LOCAL float HDDY;
+static THREAD_LOCAL float HDX;
+static THREAD_LOCAL float HDY;
+static THREAD_LOCAL float VDX;
+static THREAD_LOCAL float VDY;
+
+static THREAD_LOCAL int32_t  HDDX1616;
+static THREAD_LOCAL int32_t  HDDY1616;
+static THREAD_LOCAL int32_t  HDX1616;
+static THREAD_LOCAL int32_t  HDY1616;
+static THREAD_LOCAL int32_t  VDX1616;
+static THREAD_LOCAL int32_t  VDY1616;
+static THREAD_LOCAL int32_t  XPOS1616;
+static THREAD_LOCAL int32_t  YPOS1616;
+static THREAD_LOCAL int32_t  HDX1616_2;
+static THREAD_LOCAL int32_t  HDY1616_2;
+static THREAD_LOCAL uint32_t CEL_ORIGIN_VH_VALUE;
+static THREAD_LOCAL int8_t   TEXEL_FUN_NUMBER;
+static THREAD_LOCAL int32_t  TEXTURE_WI_START;
+static THREAD_LOCAL int32_t  TEXTURE_HI_START;
+static THREAD_LOCAL int32_t  TEXEL_INCX;
+static THREAD_LOCAL int32_t  TEXEL_INCY;
+static THREAD_LOCAL int32_t  TEXTURE_WI_LIM;
+static THREAD_LOCAL int32_t  TEXTURE_HI_LIM;
 
 static
 void
@@ -863,11 +922,14 @@ LoadPLUT(uint32_t pnt_,
     }
 }
 
-void
+uint32_t
 opera_madam_cel_handle(void)
 {
+  uint32_t ccbs;
+
   STATBITS |= SPRON;
   Flag = 0;
+  ccbs = 0;
 
   while((NEXTCCB != 0) && (!Flag))
     //if(MADAM.FSM==FSM_INPROCESS)
@@ -875,7 +937,7 @@ opera_madam_cel_handle(void)
       if((NEXTCCB == 0) || (Flag))
         {
           MADAM.FSM = FSM_IDLE;
-          return;
+          return ccbs;
         }
 
       //1st step -- parce CCB and load it into registers
@@ -883,11 +945,12 @@ opera_madam_cel_handle(void)
       if((CURRENTCCB >> 20) > 2)
         {
           MADAM.FSM = FSM_IDLE;
-          return;
+          return ccbs;
         }
 
       CCBFLAGS    = mread32(CURRENTCCB);
       CURRENTCCB += 4;
+      ccbs++;
 
       if(CCBFLAGS & CCB_PXOR)
         {
@@ -1091,6 +1154,7 @@ opera_madam_cel_handle(void)
       */
       if(!(CCBFLAGS & CCB_SKIP) && !PDATF)
         {
+          OPERA_PERF_COUNT(OPERA_PERF_MADAM_CELS,1);
           if(CCBFLAGS & CCB_PACKED)
             {
               DrawPackedCel_New();
@@ -1109,6 +1173,8 @@ opera_madam_cel_handle(void)
   /* STATBITS &= ~SPRON; */
   if((NEXTCCB == 0) || (Flag))
     MADAM.FSM = FSM_IDLE;
+
+  return ccbs;
 }
 
 static
@@ -1134,6 +1200,8 @@ DMAPBus(void)
   if((int32_t)MADAM.mregs[0x574] < 0)
     return;
 
+  /* let the frontend sample input as late as possible */
+  opera_pbus_latch();
   opera_pbus_pad();
 
   MADAM.mregs[0x574] -= 4;
@@ -1167,9 +1235,13 @@ DMAPBus(void)
 void
 opera_madam_init(uint8_t *mem_)
 {
-  int32_t i;
-  int32_t j;
-  int32_t n;
+#if IS_BIG_ENDIAN && defined(OPERA_MULTI_INSTANCE)
+  static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+  pthread_once(&tables_once,madam_tables_init);
+#elif IS_BIG_ENDIAN
+  madam_tables_init();
+#endif
 
   opera_madam_reset();
 
@@ -1186,39 +1258,6 @@ opera_madam_init(uint8_t *mem_)
   /* DRAM dux init */
   MADAM.mregs[0x4]   = 0x29;
   MADAM.mregs[0x574] = 0xFFFFFFFC;
-
-  for(i = 0; i < 32; i++)
-    for(j = 0; j < 8; j++)
-      for(n = 0; n < 4; n++)
-        PSCALAR[j][n][i] = ((i * (j + 1)) >> PDV(n));
-
-  for(i = 0; i < 256; i++)
-    {
-      pdeco_t  pix1;
-      pdeco_t  pix2;
-      uint16_t pres;
-      uint16_t resamv;
-
-      pix1.raw     = i;
-      pix2.r16b.b  = (pix1.u8b.b << 3) + (pix1.u8b.b << 1) + (pix1.u8b.b >> 1);
-      pix2.r16b.g  = (pix1.u8b.g << 2) + (pix1.u8b.g >> 1);
-      pix2.r16b.r  = (pix1.u8b.r << 2) + (pix1.u8b.r >> 1);
-      pres         = pix2.raw;
-      pres        &= 0x7fff;
-      MAPu8b[i]    = pres;
-
-      resamv       = ((pix1.c8b.m << 1) + pix1.c8b.mpw);
-      resamv       = ((resamv << 6) + (resamv << 3) + resamv);
-      MAPc8bAMV[i] = resamv;
-    }
-
-  for(i = 0; i < (8*8*8); i++)
-    {
-      pdeco_t pix1;
-
-      pix1.raw = i << 5;
-      MAPc16bAMV[i] = ((pix1.c16b.mr << 6) + (pix1.c16b.mg << 3) + pix1.c16b.mb);
-    }
 }
 
 static
@@ -1226,7 +1265,7 @@ INLINE
 uint32_t
 mread32(uint32_t addr_)
 {
-  return *((uint32_t*)&DRAM[addr_]);
+  return *((uint32_t*)&DRAM[opera_ram_bound(addr_,4)]);
 }
 
 static
@@ -1236,17 +1275,16 @@ mwrite16(const uint32_t addr_,
          const uint16_t val_)
 {
 #ifdef MSB_FIRST
-  const uint32_t addr = addr_;
+  const uint32_t addr = opera_ram_bound(addr_,2);
 #else
-  const uint32_t addr = addr_ ^ 2;
+  const uint32_t addr = opera_ram_bound(addr_ ^ 2,2);
 #endif
 
+  OPERA_PERF_COUNT(OPERA_PERF_MADAM_PIXELS_WRITTEN,1);
+
   *((uint16_t*)&DRAM[addr]) = val_;
-  if(!HIRESMODE || (addr < 0x200000))
-    return;
-  *((uint16_t*)&DRAM[addr + 1*1024*1024]) = val_;
-  *((uint16_t*)&DRAM[addr + 2*1024*1024]) = val_;
-  *((uint16_t*)&DRAM[addr + 3*1024*1024]) = val_;
+  opera_dirty_mark(addr);
+  opera_hires_write16(addr,val_);
 }
 
 static
@@ -1255,9 +1293,9 @@ uint16_t
 mread16(const uint32_t addr_)
 {
 #ifdef MSB_FIRST
-  return *((uint16_t*)&DRAM[addr_]);
+  return *((uint16_t*)&DRAM[opera_ram_bound(addr_,2)]);
 #else
-  return *((uint16_t*)&DRAM[addr_ ^ 2]);
+  return *((uint16_t*)&DRAM[opera_ram_bound(addr_ ^ 2,2)]);
 #endif
 }
 
@@ -1270,6 +1308,8 @@ PDEC(const uint32_t  pixel_,
   uint16_t resamv;
   uint16_t pres;
 
+  OPERA_PERF_COUNT(OPERA_PERF_MADAM_PIXELS_DECODED,1);
+
   pix1.raw = pixel_;
 
   switch(PRE0 & PRE0_BPP_MASK)
@@ -2749,21 +2789,31 @@ uint16_t
 readPIX(int32_t x_,
         int32_t y_)
 {
-  uint32_t src = REGCTL2;
+  uint32_t src;
+  uint32_t off;
+  uint32_t plane;
 
-  if(HIRESMODE)
-    {
-      src += XY2OFF(x_ >> 1,y_ >> 1,MADAM.rmod);
-      src += ((((y_ & 1) << 1) + (x_ & 1)) * 1024 * 1024);
-    }
-  else
+  if(!HIRESMODE)
     {
-      src += XY2OFF(x_,y_,MADAM.rmod);
+      src = opera_ram_bound((REGCTL2 + XY2OFF(x_,y_,MADAM.rmod)) ^ 2,2);
+      return *((uint16_t*)&DRAM[src]);
     }
 
-  return *((uint16_t*)&DRAM[src ^ 2]);
+  src   = (REGCTL2 + XY2OFF(x_ >> 1,y_ >> 1,MADAM.rmod));
+  src   = opera_ram_bound(src ^ 2,2);
+  plane = (((y_ & 1) << 1) + (x_ & 1));
+  off   = opera_hires_offset(src);
+  if(plane && (off != OPERA_HIRES_VRAM_SIZE) && opera_hires_is_detailed(off))
+    return *((uint16_t*)opera_hires_plane(plane,off));
+
+  return *((uint16_t*)&DRAM[src]);
 }
 
+/*
+  Sub-pixels other than (0,0) go to the hires surface and only exist
+  for VRAM. Elsewhere a hires CEL is point sampled into the guest's
+  lores image.
+*/
 static
 INLINE
 void
@@ -2771,19 +2821,39 @@ writePIX(int32_t  x_,
          int32_t  y_,
          uint16_t p_)
 {
-  uint32_t src = REGCTL3;
+  uint32_t src;
+  uint32_t off;
+  uint32_t plane;
 
-  if(HIRESMODE)
+  if(!HIRESMODE)
+    {
+      src = opera_ram_bound((REGCTL3 + XY2OFF(x_,y_,MADAM.wmod)) ^ 2,2);
+      *((uint16_t*)&DRAM[src]) = p_;
+      opera_dirty_mark(src);
+      return;
+    }
+
+  src   = (REGCTL3 + XY2OFF(x_ >> 1,y_ >> 1,MADAM.wmod));
+  src   = opera_ram_bound(src ^ 2,2);
+  plane = (((y_ & 1) << 1) + (x_ & 1));
+  off   = opera_hires_offset(src);
+  if((off == OPERA_HIRES_VRAM_SIZE) ||
+     (opera_hires_detail(off >> OPERA_HIRES_PAGE_SHIFT) != 0))
+    {
+      if(plane)
+        return;
+      *((uint16_t*)&DRAM[src]) = p_;
+    }
+  else if(plane)
     {
-      src += XY2OFF(x_ >> 1,y_ >> 1,MADAM.wmod);
-      src += ((((y_ & 1) << 1) + (x_ & 1)) * 1024 * 1024);
+      *((uint16_t*)opera_hires_plane(plane,off)) = p_;
     }
   else
     {
-      src += XY2OFF(x_,y_,MADAM.wmod);
+      *((uint16_t*)&DRAM[src]) = p_;
     }
 
-  *((uint16_t*)&DRAM[src ^ 2]) = p_;
+  opera_dirty_mark(src);
 }
 
 static
@@ -45,7 +45,7 @@ void      opera_madam_reset(void);
 uint32_t  opera_madam_fsm_get(void);
 void      opera_madam_fsm_set(uint32_t val_);
 
-void      opera_madam_cel_handle(void);
+uint32_t  opera_madam_cel_handle(void);
 
 uint32_t *opera_madam_registers(void);
 
@@ -0,0 +1,326 @@
+/* generated by tools/opera-gentables madam, do not edit */
+
+#ifndef LIBOPERA_MADAM_TABLES_I_H_INCLUDED
+#define LIBOPERA_MADAM_TABLES_I_H_INCLUDED
+
+#if IS_BIG_ENDIAN
+#error "little endian bitfield layouts, build the tables at init"
+#endif
+
+/* (i * (multiplier + 1)) >> divider */
+static const uint8_t PSCALAR[8][4][32] =
+  {
+    {
+      {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+      },
+      {
+        0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,
+        8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15
+      },
+      {
+        0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,
+        4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,7
+      },
+      {
+        0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+        2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3
+      }
+    },
+    {
+      {
+        0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+        2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3
+      },
+      {
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+        16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31
+      },
+      {
+        0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,
+        8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15
+      },
+      {
+        0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,
+        4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,7
+      }
+    },
+    {
+      {
+        0,0,0,0,0,0,1,1,1,1,1,2,2,2,2,2,
+        3,3,3,3,3,3,4,4,4,4,4,5,5,5,5,5
+      },
+      {
+        0,1,3,4,6,7,9,10,12,13,15,16,18,19,21,22,
+        24,25,27,28,30,31,33,34,36,37,39,40,42,43,45,46
+      },
+      {
+        0,0,1,2,3,3,4,5,6,6,7,8,9,9,10,11,
+        12,12,13,14,15,15,16,17,18,18,19,20,21,21,22,23
+      },
+      {
+        0,0,0,1,1,1,2,2,3,3,3,4,4,4,5,5,
+        6,6,6,7,7,7,8,8,9,9,9,10,10,10,11,11
+      }
+    },
+    {
+      {
+        0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,
+        4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,7
+      },
+      {
+        0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,
+        32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,62
+      },
+      {
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+        16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31
+      },
+      {
+        0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,
+        8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15
+      }
+    },
+    {
+      {
+        0,0,0,0,1,1,1,2,2,2,3,3,3,4,4,4,
+        5,5,5,5,6,6,6,7,7,7,8,8,8,9,9,9
+      },
+      {
+        0,2,5,7,10,12,15,17,20,22,25,27,30,32,35,37,
+        40,42,45,47,50,52,55,57,60,62,65,67,70,72,75,77
+      },
+      {
+        0,1,2,3,5,6,7,8,10,11,12,13,15,16,17,18,
+        20,21,22,23,25,26,27,28,30,31,32,33,35,36,37,38
+      },
+      {
+        0,0,1,1,2,3,3,4,5,5,6,6,7,8,8,9,
+        10,10,11,11,12,13,13,14,15,15,16,16,17,18,18,19
+      }
+    },
+    {
+      {
+        0,0,0,1,1,1,2,2,3,3,3,4,4,4,5,5,
+        6,6,6,7,7,7,8,8,9,9,9,10,10,10,11,11
+      },
+      {
+        0,3,6,9,12,15,18,21,24,27,30,33,36,39,42,45,
+        48,51,54,57,60,63,66,69,72,75,78,81,84,87,90,93
+      },
+      {
+        0,1,3,4,6,7,9,10,12,13,15,16,18,19,21,22,
+        24,25,27,28,30,31,33,34,36,37,39,40,42,43,45,46
+      },
+      {
+        0,0,1,2,3,3,4,5,6,6,7,8,9,9,10,11,
+        12,12,13,14,15,15,16,17,18,18,19,20,21,21,22,23
+      }
+    },
+    {
+      {
+        0,0,0,1,1,2,2,3,3,3,4,4,5,5,6,6,
+        7,7,7,8,8,9,9,10,10,10,11,11,12,12,13,13
+      },
+      {
+        0,3,7,10,14,17,21,24,28,31,35,38,42,45,49,52,
+        56,59,63,66,70,73,77,80,84,87,91,94,98,101,105,108
+      },
+      {
+        0,1,3,5,7,8,10,12,14,15,17,19,21,22,24,26,
+        28,29,31,33,35,36,38,40,42,43,45,47,49,50,52,54
+      },
+      {
+        0,0,1,2,3,4,5,6,7,7,8,9,10,11,12,13,
+        14,14,15,16,17,18,19,20,21,21,22,23,24,25,26,27
+      }
+    },
+    {
+      {
+        0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,
+        8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15
+      },
+      {
+        0,4,8,12,16,20,24,28,32,36,40,44,48,52,56,60,
+        64,68,72,76,80,84,88,92,96,100,104,108,112,116,120,124
+      },
+      {
+        0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,
+        32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,62
+      },
+      {
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+        16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31
+      }
+    }
+  };
+
+/* unpacked 8bpp to 555 */
+static const uint16_t MAPu8b[256+64] =
+  {
+    0x0000,0x000A,0x0015,0x001F,0x0080,0x008A,0x0095,0x009F,
+    0x0120,0x012A,0x0135,0x013F,0x01A0,0x01AA,0x01B5,0x01BF,
+    0x0240,0x024A,0x0255,0x025F,0x02C0,0x02CA,0x02D5,0x02DF,
+    0x0360,0x036A,0x0375,0x037F,0x03E0,0x03EA,0x03F5,0x03FF,
+    0x1000,0x100A,0x1015,0x101F,0x1080,0x108A,0x1095,0x109F,
+    0x1120,0x112A,0x1135,0x113F,0x11A0,0x11AA,0x11B5,0x11BF,
+    0x1240,0x124A,0x1255,0x125F,0x12C0,0x12CA,0x12D5,0x12DF,
+    0x1360,0x136A,0x1375,0x137F,0x13E0,0x13EA,0x13F5,0x13FF,
+    0x2400,0x240A,0x2415,0x241F,0x2480,0x248A,0x2495,0x249F,
+    0x2520,0x252A,0x2535,0x253F,0x25A0,0x25AA,0x25B5,0x25BF,
+    0x2640,0x264A,0x2655,0x265F,0x26C0,0x26CA,0x26D5,0x26DF,
+    0x2760,0x276A,0x2775,0x277F,0x27E0,0x27EA,0x27F5,0x27FF,
+    0x3400,0x340A,0x3415,0x341F,0x3480,0x348A,0x3495,0x349F,
+    0x3520,0x352A,0x3535,0x353F,0x35A0,0x35AA,0x35B5,0x35BF,
+    0x3640,0x364A,0x3655,0x365F,0x36C0,0x36CA,0x36D5,0x36DF,
+    0x3760,0x376A,0x3775,0x377F,0x37E0,0x37EA,0x37F5,0x37FF,
+    0x4800,0x480A,0x4815,0x481F,0x4880,0x488A,0x4895,0x489F,
+    0x4920,0x492A,0x4935,0x493F,0x49A0,0x49AA,0x49B5,0x49BF,
+    0x4A40,0x4A4A,0x4A55,0x4A5F,0x4AC0,0x4ACA,0x4AD5,0x4ADF,
+    0x4B60,0x4B6A,0x4B75,0x4B7F,0x4BE0,0x4BEA,0x4BF5,0x4BFF,
+    0x5800,0x580A,0x5815,0x581F,0x5880,0x588A,0x5895,0x589F,
+    0x5920,0x592A,0x5935,0x593F,0x59A0,0x59AA,0x59B5,0x59BF,
+    0x5A40,0x5A4A,0x5A55,0x5A5F,0x5AC0,0x5ACA,0x5AD5,0x5ADF,
+    0x5B60,0x5B6A,0x5B75,0x5B7F,0x5BE0,0x5BEA,0x5BF5,0x5BFF,
+    0x6C00,0x6C0A,0x6C15,0x6C1F,0x6C80,0x6C8A,0x6C95,0x6C9F,
+    0x6D20,0x6D2A,0x6D35,0x6D3F,0x6DA0,0x6DAA,0x6DB5,0x6DBF,
+    0x6E40,0x6E4A,0x6E55,0x6E5F,0x6EC0,0x6ECA,0x6ED5,0x6EDF,
+    0x6F60,0x6F6A,0x6F75,0x6F7F,0x6FE0,0x6FEA,0x6FF5,0x6FFF,
+    0x7C00,0x7C0A,0x7C15,0x7C1F,0x7C80,0x7C8A,0x7C95,0x7C9F,
+    0x7D20,0x7D2A,0x7D35,0x7D3F,0x7DA0,0x7DAA,0x7DB5,0x7DBF,
+    0x7E40,0x7E4A,0x7E55,0x7E5F,0x7EC0,0x7ECA,0x7ED5,0x7EDF,
+    0x7F60,0x7F6A,0x7F75,0x7F7F,0x7FE0,0x7FEA,0x7FF5,0x7FFF,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+  };
+
+/* coded 8bpp to AMV */
+static const uint16_t MAPc8bAMV[256+64] =
+  {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,
+    0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,
+    0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,
+    0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,
+    0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,
+    0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,
+    0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,
+    0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,0x0092,
+    0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,
+    0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,
+    0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,
+    0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,0x00DB,
+    0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,
+    0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,
+    0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,
+    0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,0x0124,
+    0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,
+    0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,
+    0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,
+    0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,0x016D,
+    0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,
+    0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,
+    0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,
+    0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,0x01B6,
+    0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,
+    0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,
+    0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,
+    0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,0x01FF,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+  };
+
+/* coded 16bpp to AMV */
+static const uint16_t MAPc16bAMV[8*8*8+64] =
+  {
+    0x0000,0x0001,0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,
+    0x0008,0x0009,0x000A,0x000B,0x000C,0x000D,0x000E,0x000F,
+    0x0010,0x0011,0x0012,0x0013,0x0014,0x0015,0x0016,0x0017,
+    0x0018,0x0019,0x001A,0x001B,0x001C,0x001D,0x001E,0x001F,
+    0x0020,0x0021,0x0022,0x0023,0x0024,0x0025,0x0026,0x0027,
+    0x0028,0x0029,0x002A,0x002B,0x002C,0x002D,0x002E,0x002F,
+    0x0030,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,
+    0x0038,0x0039,0x003A,0x003B,0x003C,0x003D,0x003E,0x003F,
+    0x0040,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,
+    0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,
+    0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,
+    0x0058,0x0059,0x005A,0x005B,0x005C,0x005D,0x005E,0x005F,
+    0x0060,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,
+    0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,
+    0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,
+    0x0078,0x0079,0x007A,0x007B,0x007C,0x007D,0x007E,0x007F,
+    0x0080,0x0081,0x0082,0x0083,0x0084,0x0085,0x0086,0x0087,
+    0x0088,0x0089,0x008A,0x008B,0x008C,0x008D,0x008E,0x008F,
+    0x0090,0x0091,0x0092,0x0093,0x0094,0x0095,0x0096,0x0097,
+    0x0098,0x0099,0x009A,0x009B,0x009C,0x009D,0x009E,0x009F,
+    0x00A0,0x00A1,0x00A2,0x00A3,0x00A4,0x00A5,0x00A6,0x00A7,
+    0x00A8,0x00A9,0x00AA,0x00AB,0x00AC,0x00AD,0x00AE,0x00AF,
+    0x00B0,0x00B1,0x00B2,0x00B3,0x00B4,0x00B5,0x00B6,0x00B7,
+    0x00B8,0x00B9,0x00BA,0x00BB,0x00BC,0x00BD,0x00BE,0x00BF,
+    0x00C0,0x00C1,0x00C2,0x00C3,0x00C4,0x00C5,0x00C6,0x00C7,
+    0x00C8,0x00C9,0x00CA,0x00CB,0x00CC,0x00CD,0x00CE,0x00CF,
+    0x00D0,0x00D1,0x00D2,0x00D3,0x00D4,0x00D5,0x00D6,0x00D7,
+    0x00D8,0x00D9,0x00DA,0x00DB,0x00DC,0x00DD,0x00DE,0x00DF,
+    0x00E0,0x00E1,0x00E2,0x00E3,0x00E4,0x00E5,0x00E6,0x00E7,
+    0x00E8,0x00E9,0x00EA,0x00EB,0x00EC,0x00ED,0x00EE,0x00EF,
+    0x00F0,0x00F1,0x00F2,0x00F3,0x00F4,0x00F5,0x00F6,0x00F7,
+    0x00F8,0x00F9,0x00FA,0x00FB,0x00FC,0x00FD,0x00FE,0x00FF,
+    0x0100,0x0101,0x0102,0x0103,0x0104,0x0105,0x0106,0x0107,
+    0x0108,0x0109,0x010A,0x010B,0x010C,0x010D,0x010E,0x010F,
+    0x0110,0x0111,0x0112,0x0113,0x0114,0x0115,0x0116,0x0117,
+    0x0118,0x0119,0x011A,0x011B,0x011C,0x011D,0x011E,0x011F,
+    0x0120,0x0121,0x0122,0x0123,0x0124,0x0125,0x0126,0x0127,
+    0x0128,0x0129,0x012A,0x012B,0x012C,0x012D,0x012E,0x012F,
+    0x0130,0x0131,0x0132,0x0133,0x0134,0x0135,0x0136,0x0137,
+    0x0138,0x0139,0x013A,0x013B,0x013C,0x013D,0x013E,0x013F,
+    0x0140,0x0141,0x0142,0x0143,0x0144,0x0145,0x0146,0x0147,
+    0x0148,0x0149,0x014A,0x014B,0x014C,0x014D,0x014E,0x014F,
+    0x0150,0x0151,0x0152,0x0153,0x0154,0x0155,0x0156,0x0157,
+    0x0158,0x0159,0x015A,0x015B,0x015C,0x015D,0x015E,0x015F,
+    0x0160,0x0161,0x0162,0x0163,0x0164,0x0165,0x0166,0x0167,
+    0x0168,0x0169,0x016A,0x016B,0x016C,0x016D,0x016E,0x016F,
+    0x0170,0x0171,0x0172,0x0173,0x0174,0x0175,0x0176,0x0177,
+    0x0178,0x0179,0x017A,0x017B,0x017C,0x017D,0x017E,0x017F,
+    0x0180,0x0181,0x0182,0x0183,0x0184,0x0185,0x0186,0x0187,
+    0x0188,0x0189,0x018A,0x018B,0x018C,0x018D,0x018E,0x018F,
+    0x0190,0x0191,0x0192,0x0193,0x0194,0x0195,0x0196,0x0197,
+    0x0198,0x0199,0x019A,0x019B,0x019C,0x019D,0x019E,0x019F,
+    0x01A0,0x01A1,0x01A2,0x01A3,0x01A4,0x01A5,0x01A6,0x01A7,
+    0x01A8,0x01A9,0x01AA,0x01AB,0x01AC,0x01AD,0x01AE,0x01AF,
+    0x01B0,0x01B1,0x01B2,0x01B3,0x01B4,0x01B5,0x01B6,0x01B7,
+    0x01B8,0x01B9,0x01BA,0x01BB,0x01BC,0x01BD,0x01BE,0x01BF,
+    0x01C0,0x01C1,0x01C2,0x01C3,0x01C4,0x01C5,0x01C6,0x01C7,
+    0x01C8,0x01C9,0x01CA,0x01CB,0x01CC,0x01CD,0x01CE,0x01CF,
+    0x01D0,0x01D1,0x01D2,0x01D3,0x01D4,0x01D5,0x01D6,0x01D7,
+    0x01D8,0x01D9,0x01DA,0x01DB,0x01DC,0x01DD,0x01DE,0x01DF,
+    0x01E0,0x01E1,0x01E2,0x01E3,0x01E4,0x01E5,0x01E6,0x01E7,
+    0x01E8,0x01E9,0x01EA,0x01EB,0x01EC,0x01ED,0x01EE,0x01EF,
+    0x01F0,0x01F1,0x01F2,0x01F3,0x01F4,0x01F5,0x01F6,0x01F7,
+    0x01F8,0x01F9,0x01FA,0x01FB,0x01FC,0x01FD,0x01FE,0x01FF,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+  };
+
+#endif /* LIBOPERA_MADAM_TABLES_I_H_INCLUDED */
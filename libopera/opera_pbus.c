@@ -1,5 +1,7 @@
 #include "opera_pbus.h"
+#include "thread_local.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define PBUS_BUF_SIZE 256
@@ -63,7 +65,8 @@ struct pbus_s
 
 typedef struct pbus_s pbus_t;
 
-static pbus_t PBUS = {0,{0}};
+static THREAD_LOCAL pbus_t PBUS = {0,{0}};
+static THREAD_LOCAL opera_pbus_latch_cb_t LATCH_CB = NULL;
 
 void
 opera_pbus_add_joypad(const opera_pbus_joypad_t *jp_)
@@ -263,3 +266,26 @@ opera_pbus_reset(void)
 {
   PBUS.idx = 0;
 }
+
+/*
+  One shot: the callback is cleared before being called so it may
+  rebuild the buffer with opera_pbus_reset() and opera_pbus_add_*().
+*/
+void
+opera_pbus_set_latch_cb(opera_pbus_latch_cb_t cb_)
+{
+  LATCH_CB = cb_;
+}
+
+void
+opera_pbus_latch(void)
+{
+  opera_pbus_latch_cb_t cb;
+
+  cb = LATCH_CB;
+  if(cb == NULL)
+    return;
+
+  LATCH_CB = NULL;
+  cb();
+}
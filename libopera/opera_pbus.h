@@ -90,10 +90,14 @@ typedef struct opera_pbus_lightgun_s opera_pbus_lightgun_t;
 typedef struct opera_pbus_arcade_lightgun_s opera_pbus_arcade_lightgun_t;
 typedef struct opera_pbus_orbatak_trackball_s opera_pbus_orbatak_trackball_t;
 
+typedef void (*opera_pbus_latch_cb_t)(void);
+
 void*    opera_pbus_buf(void);
 uint32_t opera_pbus_size(void);
 void     opera_pbus_pad(void);
 void     opera_pbus_reset(void);
+void     opera_pbus_set_latch_cb(opera_pbus_latch_cb_t cb_);
+void     opera_pbus_latch(void);
 void     opera_pbus_add_joypad(const opera_pbus_joypad_t *joypad_);
 void     opera_pbus_add_flightstick(const opera_pbus_flightstick_t *fs_);
 void     opera_pbus_add_mouse(const opera_pbus_mouse_t *mouse_);
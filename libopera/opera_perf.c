@@ -0,0 +1,139 @@
+#include "opera_perf.h"
+#include "thread_local.h"
+
+#ifdef OPERA_PERF
+
+#include <string.h>
+
+#define PERF_MAX_DEPTH 8
+
+struct perf_frame_s
+{
+  uint64_t start;
+  uint64_t children;
+};
+
+typedef struct perf_frame_s perf_frame_t;
+
+THREAD_LOCAL uint64_t OPERA_PERF_COUNTERS[OPERA_PERF_COUNTER_COUNT];
+
+static THREAD_LOCAL opera_perf_clock_cb_t g_PERF_CLOCK = NULL;
+static THREAD_LOCAL uint64_t              g_PERF_TIMES[OPERA_PERF_TIMER_COUNT];
+static THREAD_LOCAL uint64_t              g_PERF_CALLS[OPERA_PERF_TIMER_COUNT];
+static THREAD_LOCAL perf_frame_t          g_PERF_STACK[PERF_MAX_DEPTH];
+static THREAD_LOCAL uint32_t              g_PERF_DEPTH = 0;
+
+static const char *PERF_TIMER_NAMES[OPERA_PERF_TIMER_COUNT] =
+  {
+    "arm",
+    "madam",
+    "vdlp",
+    "dsp",
+    "dma",
+    "cdrom"
+  };
+
+static const char *PERF_COUNTER_NAMES[OPERA_PERF_COUNTER_COUNT] =
+  {
+    "arm_insns",
+    "arm_cycles",
+    "madam_cels",
+    "madam_pixels_decoded",
+    "madam_pixels_written",
+    "vdlp_lines",
+    "dsp_samples",
+    "dsp_insns",
+    "dma_bytes",
+    "cdrom_bytes"
+  };
+
+void
+opera_perf_set_clock(opera_perf_clock_cb_t cb_)
+{
+  g_PERF_CLOCK = cb_;
+}
+
+void
+opera_perf_reset(void)
+{
+  memset(g_PERF_TIMES,0,sizeof(g_PERF_TIMES));
+  memset(g_PERF_CALLS,0,sizeof(g_PERF_CALLS));
+  memset(OPERA_PERF_COUNTERS,0,sizeof(OPERA_PERF_COUNTERS));
+}
+
+void
+opera_perf_begin(const opera_perf_timer_e timer_)
+{
+  perf_frame_t *frame;
+
+  if((g_PERF_CLOCK == NULL) || (g_PERF_DEPTH >= PERF_MAX_DEPTH))
+    return;
+
+  frame = &g_PERF_STACK[g_PERF_DEPTH++];
+  frame->children = 0;
+  frame->start    = g_PERF_CLOCK();
+}
+
+void
+opera_perf_end(const opera_perf_timer_e timer_)
+{
+  uint64_t elapsed;
+  perf_frame_t *frame;
+
+  if((g_PERF_CLOCK == NULL) || (g_PERF_DEPTH == 0))
+    return;
+
+  frame   = &g_PERF_STACK[--g_PERF_DEPTH];
+  elapsed = (g_PERF_CLOCK() - frame->start);
+
+  g_PERF_TIMES[timer_] += (elapsed - frame->children);
+  g_PERF_CALLS[timer_]++;
+
+  if(g_PERF_DEPTH)
+    g_PERF_STACK[g_PERF_DEPTH - 1].children += elapsed;
+}
+
+uint64_t
+opera_perf_time(const opera_perf_timer_e timer_)
+{
+  return g_PERF_TIMES[timer_];
+}
+
+uint64_t
+opera_perf_calls(const opera_perf_timer_e timer_)
+{
+  return g_PERF_CALLS[timer_];
+}
+
+uint64_t
+opera_perf_total_time(void)
+{
+  int i;
+  uint64_t total;
+
+  total = 0;
+  for(i = 0; i < OPERA_PERF_TIMER_COUNT; i++)
+    total += g_PERF_TIMES[i];
+
+  return total;
+}
+
+uint64_t
+opera_perf_counter(const opera_perf_counter_e counter_)
+{
+  return OPERA_PERF_COUNTERS[counter_];
+}
+
+const char*
+opera_perf_timer_name(const opera_perf_timer_e timer_)
+{
+  return PERF_TIMER_NAMES[timer_];
+}
+
+const char*
+opera_perf_counter_name(const opera_perf_counter_e counter_)
+{
+  return PERF_COUNTER_NAMES[counter_];
+}
+
+#endif
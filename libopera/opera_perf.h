@@ -0,0 +1,93 @@
+#ifndef LIBOPERA_PERF_H_INCLUDED
+#define LIBOPERA_PERF_H_INCLUDED
+
+#include "extern_c.h"
+#include "inline.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+
+/*
+  Host time and event counts per subsystem. The host supplies the
+  clock, any monotonic tick source will do. Timers nest and each one
+  only accumulates its exclusive time, so OPERA_PERF_ARM (which wraps
+  the whole frame) ends up holding what the CPU and the glue between
+  subsystems cost. Built without OPERA_PERF everything compiles away
+  and queries return zero.
+*/
+
+enum opera_perf_timer_e
+  {
+    OPERA_PERF_ARM,
+    OPERA_PERF_MADAM,
+    OPERA_PERF_VDLP,
+    OPERA_PERF_DSP,
+    OPERA_PERF_DMA,
+    OPERA_PERF_CDROM,
+    OPERA_PERF_TIMER_COUNT
+  };
+
+enum opera_perf_counter_e
+  {
+    OPERA_PERF_ARM_INSNS,
+    OPERA_PERF_ARM_CYCLES,
+    OPERA_PERF_MADAM_CELS,
+    OPERA_PERF_MADAM_PIXELS_DECODED,
+    OPERA_PERF_MADAM_PIXELS_WRITTEN,
+    OPERA_PERF_VDLP_LINES,
+    OPERA_PERF_DSP_SAMPLES,
+    OPERA_PERF_DSP_INSNS,
+    OPERA_PERF_DMA_BYTES,
+    OPERA_PERF_CDROM_BYTES,
+    OPERA_PERF_COUNTER_COUNT
+  };
+
+typedef enum opera_perf_timer_e opera_perf_timer_e;
+typedef enum opera_perf_counter_e opera_perf_counter_e;
+
+typedef uint64_t (*opera_perf_clock_cb_t)(void);
+
+EXTERN_C_BEGIN
+
+#ifdef OPERA_PERF
+
+extern THREAD_LOCAL uint64_t OPERA_PERF_COUNTERS[OPERA_PERF_COUNTER_COUNT];
+
+void        opera_perf_set_clock(opera_perf_clock_cb_t cb_);
+void        opera_perf_reset(void);
+
+void        opera_perf_begin(const opera_perf_timer_e timer_);
+void        opera_perf_end(const opera_perf_timer_e timer_);
+
+uint64_t    opera_perf_time(const opera_perf_timer_e timer_);
+uint64_t    opera_perf_calls(const opera_perf_timer_e timer_);
+uint64_t    opera_perf_total_time(void);
+uint64_t    opera_perf_counter(const opera_perf_counter_e counter_);
+
+const char *opera_perf_timer_name(const opera_perf_timer_e timer_);
+const char *opera_perf_counter_name(const opera_perf_counter_e counter_);
+
+#define OPERA_PERF_BEGIN(T)   opera_perf_begin(T)
+#define OPERA_PERF_END(T)     opera_perf_end(T)
+#define OPERA_PERF_COUNT(C,N) (OPERA_PERF_COUNTERS[(C)] += (N))
+
+#else
+
+static INLINE void        opera_perf_set_clock(opera_perf_clock_cb_t cb_) {}
+static INLINE void        opera_perf_reset(void) {}
+static INLINE uint64_t    opera_perf_time(const opera_perf_timer_e timer_) { return 0; }
+static INLINE uint64_t    opera_perf_calls(const opera_perf_timer_e timer_) { return 0; }
+static INLINE uint64_t    opera_perf_total_time(void) { return 0; }
+static INLINE uint64_t    opera_perf_counter(const opera_perf_counter_e counter_) { return 0; }
+static INLINE const char *opera_perf_timer_name(const opera_perf_timer_e timer_) { return ""; }
+static INLINE const char *opera_perf_counter_name(const opera_perf_counter_e counter_) { return ""; }
+
+#define OPERA_PERF_BEGIN(T)
+#define OPERA_PERF_END(T)
+#define OPERA_PERF_COUNT(C,N)
+
+#endif
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_PERF_H_INCLUDED */
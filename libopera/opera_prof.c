@@ -0,0 +1,510 @@
+#include "opera_prof.h"
+#include "thread_local.h"
+
+#ifdef OPERA_PROF
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROF_RAM_SIZE     0x00600000
+#define PROF_ROM_BASE     0x03000000
+#define PROF_ROM_SIZE     0x00200000
+#define PROF_PAIR_COUNT   16384
+#define PROF_SWI_COUNT    1024
+#define PROF_HOT_ADDRS    32
+#define PROF_EMPTY        0xFFFFFFFFFFFFFFFFULL
+
+enum prof_region_e
+  {
+    PROF_REGION_DRAM,
+    PROF_REGION_VRAM,
+    PROF_REGION_ROM,
+    PROF_REGION_OTHER,
+    PROF_REGION_COUNT
+  };
+
+static const char *PROF_REGION_NAMES[PROF_REGION_COUNT] =
+  {
+    "[dram]",
+    "[vram]",
+    "[rom]",
+    "[other]"
+  };
+
+struct prof_symbol_s
+{
+  uint32_t  start;
+  uint32_t  end;
+  char     *name;
+};
+
+typedef struct prof_symbol_s prof_symbol_t;
+
+struct prof_entry_s
+{
+  uint64_t key;
+  uint32_t count;
+};
+
+typedef struct prof_entry_s prof_entry_t;
+
+struct prof_s
+{
+  uint32_t      *ram_counts;
+  uint32_t      *rom_counts;
+  uint32_t       other_count;
+
+  prof_entry_t   pairs[PROF_PAIR_COUNT];
+  uint32_t       pairs_dropped;
+  prof_entry_t   swis[PROF_SWI_COUNT];
+  uint32_t       swis_dropped;
+
+  uint64_t       samples;
+};
+
+typedef struct prof_s prof_t;
+
+struct prof_buf_s
+{
+  char   *data;
+  size_t  len;
+  size_t  cap;
+};
+
+typedef struct prof_buf_s prof_buf_t;
+
+THREAD_LOCAL opera_prof_hot_t OPERA_PROF_HOT = {0,0,0};
+
+static THREAD_LOCAL prof_t *g_PROF = NULL;
+static THREAD_LOCAL prof_symbol_t *g_SYMBOLS = NULL;
+static THREAD_LOCAL uint32_t g_SYMBOL_COUNT = 0;
+
+static
+void
+buf_printf(prof_buf_t *buf_,
+           const char *fmt_,
+           ...)
+{
+  int n;
+  char *tmp;
+  va_list args;
+
+  for(;;)
+    {
+      va_start(args,fmt_);
+      n = vsnprintf(buf_->data + buf_->len,buf_->cap - buf_->len,fmt_,args);
+      va_end(args);
+
+      if(n < 0)
+        return;
+      if((buf_->len + n) < buf_->cap)
+        break;
+
+      tmp = realloc(buf_->data,(buf_->cap * 2) + n + 1);
+      if(tmp == NULL)
+        return;
+      buf_->data = tmp;
+      buf_->cap  = (buf_->cap * 2) + n + 1;
+    }
+
+  buf_->len += n;
+}
+
+static
+int
+buf_init(prof_buf_t *buf_)
+{
+  buf_->len  = 0;
+  buf_->cap  = 4096;
+  buf_->data = malloc(buf_->cap);
+  if(buf_->data == NULL)
+    return -1;
+
+  buf_->data[0] = '\0';
+
+  return 0;
+}
+
+static
+int
+symbol_cmp(const void *a_,
+           const void *b_)
+{
+  const prof_symbol_t *a = a_;
+  const prof_symbol_t *b = b_;
+
+  return ((a->start > b->start) - (a->start < b->start));
+}
+
+static
+void
+symbols_free(void)
+{
+  uint32_t i;
+
+  for(i = 0; i < g_SYMBOL_COUNT; i++)
+    free(g_SYMBOLS[i].name);
+  free(g_SYMBOLS);
+
+  g_SYMBOLS      = NULL;
+  g_SYMBOL_COUNT = 0;
+}
+
+static
+uint32_t
+region_of(const uint32_t addr_)
+{
+  if(addr_ < 0x00200000)
+    return PROF_REGION_DRAM;
+  if(addr_ < PROF_RAM_SIZE)
+    return PROF_REGION_VRAM;
+  if((addr_ - PROF_ROM_BASE) < PROF_ROM_SIZE)
+    return PROF_REGION_ROM;
+  return PROF_REGION_OTHER;
+}
+
+/* symbol index, or symbol count + region when no symbol covers it */
+static
+uint32_t
+symbol_of(const uint32_t addr_)
+{
+  uint32_t lo;
+  uint32_t hi;
+  uint32_t mid;
+
+  lo = 0;
+  hi = g_SYMBOL_COUNT;
+  while(lo < hi)
+    {
+      mid = ((lo + hi) >> 1);
+      if(g_SYMBOLS[mid].start <= addr_)
+        lo = (mid + 1);
+      else
+        hi = mid;
+    }
+
+  if(lo && (addr_ < g_SYMBOLS[lo - 1].end))
+    return (lo - 1);
+
+  return (g_SYMBOL_COUNT + region_of(addr_));
+}
+
+static
+const char*
+symbol_name(const uint32_t idx_)
+{
+  if(idx_ < g_SYMBOL_COUNT)
+    return g_SYMBOLS[idx_].name;
+
+  return PROF_REGION_NAMES[idx_ - g_SYMBOL_COUNT];
+}
+
+static
+int
+table_add(prof_entry_t   *table_,
+          const uint32_t  size_,
+          const uint64_t  key_)
+{
+  uint32_t i;
+  uint32_t n;
+
+  i = (uint32_t)((key_ * 0x9E3779B97F4A7C15ULL) >> 32) & (size_ - 1);
+  for(n = 0; n < size_; n++)
+    {
+      if(table_[i].key == key_)
+        {
+          table_[i].count++;
+          return 0;
+        }
+
+      if(table_[i].key == PROF_EMPTY)
+        {
+          table_[i].key   = key_;
+          table_[i].count = 1;
+          return 0;
+        }
+
+      i = ((i + 1) & (size_ - 1));
+    }
+
+  return -1;
+}
+
+static
+int
+entry_cmp(const void *a_,
+          const void *b_)
+{
+  const prof_entry_t *a = a_;
+  const prof_entry_t *b = b_;
+
+  return ((a->count < b->count) - (a->count > b->count));
+}
+
+int
+opera_prof_symbols_parse(const char *text_)
+{
+  uint32_t i;
+  uint32_t cap;
+  uint32_t start;
+  uint32_t end;
+  char name[256];
+  const char *line;
+  prof_symbol_t *tmp;
+
+  symbols_free();
+
+  cap = 0;
+  for(line = text_; line != NULL; line = strchr(line,'\n'))
+    {
+      while(*line == '\n')
+        line++;
+      if((*line == '\0') || (*line == '#'))
+        continue;
+
+      if(sscanf(line,"%x %x %255s",&start,&end,name) != 3)
+        {
+          if(sscanf(line,"%x %255s",&start,name) != 2)
+            continue;
+          end = 0;
+        }
+
+      if(g_SYMBOL_COUNT == cap)
+        {
+          cap = (cap ? (cap * 2) : 256);
+          tmp = realloc(g_SYMBOLS,cap * sizeof(prof_symbol_t));
+          if(tmp == NULL)
+            break;
+          g_SYMBOLS = tmp;
+        }
+
+      g_SYMBOLS[g_SYMBOL_COUNT].start = start;
+      g_SYMBOLS[g_SYMBOL_COUNT].end   = end;
+      g_SYMBOLS[g_SYMBOL_COUNT].name  = strdup(name);
+      g_SYMBOL_COUNT++;
+    }
+
+  qsort(g_SYMBOLS,g_SYMBOL_COUNT,sizeof(prof_symbol_t),symbol_cmp);
+
+  /* symbols without an explicit end run up to the next one */
+  for(i = 0; i < g_SYMBOL_COUNT; i++)
+    {
+      if(g_SYMBOLS[i].end > g_SYMBOLS[i].start)
+        continue;
+      g_SYMBOLS[i].end = (((i + 1) < g_SYMBOL_COUNT) ?
+                          g_SYMBOLS[i + 1].start :
+                          0xFFFFFFFF);
+    }
+
+  return g_SYMBOL_COUNT;
+}
+
+static
+void
+prof_free(void)
+{
+  if(g_PROF == NULL)
+    return;
+
+  free(g_PROF->ram_counts);
+  free(g_PROF->rom_counts);
+  free(g_PROF);
+  g_PROF = NULL;
+}
+
+void
+opera_prof_disable(void)
+{
+  OPERA_PROF_HOT.enabled = 0;
+
+  prof_free();
+  symbols_free();
+}
+
+/* symbols must be parsed before enabling, samples resolve them eagerly */
+int
+opera_prof_enable(const uint32_t interval_)
+{
+  uint32_t i;
+
+  OPERA_PROF_HOT.enabled = 0;
+
+  prof_free();
+
+  g_PROF = calloc(1,sizeof(prof_t));
+  if(g_PROF == NULL)
+    return -1;
+
+  g_PROF->ram_counts = calloc(PROF_RAM_SIZE >> 2,sizeof(uint32_t));
+  g_PROF->rom_counts = calloc(PROF_ROM_SIZE >> 2,sizeof(uint32_t));
+  if((g_PROF->ram_counts == NULL) || (g_PROF->rom_counts == NULL))
+    {
+      prof_free();
+      return -1;
+    }
+
+  for(i = 0; i < PROF_PAIR_COUNT; i++)
+    g_PROF->pairs[i].key = PROF_EMPTY;
+  for(i = 0; i < PROF_SWI_COUNT; i++)
+    g_PROF->swis[i].key = PROF_EMPTY;
+
+  OPERA_PROF_HOT.interval  = (interval_ ? interval_ : OPERA_PROF_DEFAULT_INTERVAL);
+  OPERA_PROF_HOT.countdown = OPERA_PROF_HOT.interval;
+  OPERA_PROF_HOT.enabled   = 1;
+
+  return 0;
+}
+
+void
+opera_prof_sample(const uint32_t pc_,
+                  const uint32_t lr_)
+{
+  uint64_t key;
+
+  g_PROF->samples++;
+
+  if(pc_ < PROF_RAM_SIZE)
+    g_PROF->ram_counts[pc_ >> 2]++;
+  else if((pc_ - PROF_ROM_BASE) < PROF_ROM_SIZE)
+    g_PROF->rom_counts[(pc_ - PROF_ROM_BASE) >> 2]++;
+  else
+    g_PROF->other_count++;
+
+  key = (((uint64_t)symbol_of(lr_) << 32) | symbol_of(pc_));
+  if(table_add(g_PROF->pairs,PROF_PAIR_COUNT,key) == -1)
+    g_PROF->pairs_dropped++;
+}
+
+void
+opera_prof_swi(const uint32_t swi_)
+{
+  if(table_add(g_PROF->swis,PROF_SWI_COUNT,swi_) == -1)
+    g_PROF->swis_dropped++;
+}
+
+static
+void
+hot_insert(prof_entry_t   *hot_,
+           const uint32_t  addr_,
+           const uint32_t  count_)
+{
+  int i;
+
+  if(count_ <= hot_[PROF_HOT_ADDRS - 1].count)
+    return;
+
+  for(i = (PROF_HOT_ADDRS - 1); (i > 0) && (hot_[i - 1].count < count_); i--)
+    hot_[i] = hot_[i - 1];
+
+  hot_[i].key   = addr_;
+  hot_[i].count = count_;
+}
+
+static
+double
+percent(const uint64_t count_,
+        const uint64_t total_)
+{
+  return (total_ ? ((count_ * 100.0) / total_) : 0.0);
+}
+
+char*
+opera_prof_report_flat(void)
+{
+  uint32_t i;
+  uint32_t n;
+  uint64_t total;
+  prof_buf_t buf;
+  prof_entry_t *syms;
+  prof_entry_t hot[PROF_HOT_ADDRS];
+  prof_entry_t swis[PROF_SWI_COUNT];
+
+  if((g_PROF == NULL) || (buf_init(&buf) == -1))
+    return NULL;
+
+  total = g_PROF->samples;
+  buf_printf(&buf,"# %llu samples, one every %d cycles\n",
+             (unsigned long long)total,
+             OPERA_PROF_HOT.interval);
+
+  n    = (g_SYMBOL_COUNT + PROF_REGION_COUNT);
+  syms = calloc(n,sizeof(prof_entry_t));
+  if(syms != NULL)
+    {
+      for(i = 0; i < n; i++)
+        syms[i].key = i;
+      for(i = 0; i < PROF_PAIR_COUNT; i++)
+        if(g_PROF->pairs[i].key != PROF_EMPTY)
+          syms[g_PROF->pairs[i].key & 0xFFFFFFFF].count += g_PROF->pairs[i].count;
+      qsort(syms,n,sizeof(prof_entry_t),entry_cmp);
+
+      buf_printf(&buf,"\n# samples  percent  symbol\n");
+      for(i = 0; (i < n) && syms[i].count; i++)
+        buf_printf(&buf,"%9u  %6.2f%%  %s\n",
+                   syms[i].count,
+                   percent(syms[i].count,total),
+                   symbol_name(syms[i].key));
+      free(syms);
+    }
+
+  memset(hot,0,sizeof(hot));
+  for(i = 0; i < (PROF_RAM_SIZE >> 2); i++)
+    hot_insert(hot,i << 2,g_PROF->ram_counts[i]);
+  for(i = 0; i < (PROF_ROM_SIZE >> 2); i++)
+    hot_insert(hot,PROF_ROM_BASE + (i << 2),g_PROF->rom_counts[i]);
+
+  buf_printf(&buf,"\n# samples  percent  address     symbol\n");
+  for(i = 0; (i < PROF_HOT_ADDRS) && hot[i].count; i++)
+    {
+      n = symbol_of(hot[i].key);
+      buf_printf(&buf,"%9u  %6.2f%%  0x%08X  %s+0x%X\n",
+                 hot[i].count,
+                 percent(hot[i].count,total),
+                 (uint32_t)hot[i].key,
+                 symbol_name(n),
+                 (uint32_t)hot[i].key - ((n < g_SYMBOL_COUNT) ? g_SYMBOLS[n].start : 0));
+    }
+
+  memcpy(swis,g_PROF->swis,sizeof(swis));
+  qsort(swis,PROF_SWI_COUNT,sizeof(prof_entry_t),entry_cmp);
+
+  buf_printf(&buf,"\n#    calls  swi\n");
+  for(i = 0; (i < PROF_SWI_COUNT) && swis[i].count; i++)
+    buf_printf(&buf,"%10u  0x%06X\n",swis[i].count,(uint32_t)swis[i].key);
+
+  if(g_PROF->pairs_dropped || g_PROF->swis_dropped)
+    buf_printf(&buf,"\n# dropped: %u samples, %u swis\n",
+               g_PROF->pairs_dropped,
+               g_PROF->swis_dropped);
+
+  return buf.data;
+}
+
+char*
+opera_prof_report_folded(void)
+{
+  uint32_t i;
+  prof_buf_t buf;
+  const prof_entry_t *e;
+
+  if((g_PROF == NULL) || (buf_init(&buf) == -1))
+    return NULL;
+
+  for(i = 0; i < PROF_PAIR_COUNT; i++)
+    {
+      e = &g_PROF->pairs[i];
+      if(e->key == PROF_EMPTY)
+        continue;
+
+      buf_printf(&buf,"%s;%s %u\n",
+                 symbol_name(e->key >> 32),
+                 symbol_name(e->key & 0xFFFFFFFF),
+                 e->count);
+    }
+
+  return buf.data;
+}
+
+#endif
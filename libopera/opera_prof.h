@@ -0,0 +1,85 @@
+#ifndef LIBOPERA_PROF_H_INCLUDED
+#define LIBOPERA_PROF_H_INCLUDED
+
+#include "extern_c.h"
+#include "inline.h"
+#include "thread_local.h"
+
+#include <stdint.h>
+
+/*
+  Guest code sampling profiler. Every `interval` emulated cycles the
+  address of the instruction just executed and the link register are
+  recorded, and every SWI is counted. Addresses are attributed to
+  symbols from a user supplied table (one "start end name" or
+  "start name" per line, hex addresses) and otherwise to a memory
+  region. Reports come back as heap allocated text: a flat profile
+  and a folded "caller;callee count" profile suitable for flame
+  graph tools. Built without OPERA_PROF the hooks compile away.
+*/
+
+#define OPERA_PROF_DEFAULT_INTERVAL 1024
+
+struct opera_prof_hot_s
+{
+  int     enabled;
+  int32_t countdown;
+  int32_t interval;
+};
+
+typedef struct opera_prof_hot_s opera_prof_hot_t;
+
+EXTERN_C_BEGIN
+
+#ifdef OPERA_PROF
+
+extern THREAD_LOCAL opera_prof_hot_t OPERA_PROF_HOT;
+
+int   opera_prof_symbols_parse(const char *text_);
+int   opera_prof_enable(const uint32_t interval_);
+void  opera_prof_disable(void);
+
+void  opera_prof_sample(const uint32_t pc_,
+                        const uint32_t lr_);
+void  opera_prof_swi(const uint32_t swi_);
+
+char *opera_prof_report_flat(void);
+char *opera_prof_report_folded(void);
+
+static
+INLINE
+void
+opera_prof_tick(const uint32_t pc_,
+                const uint32_t lr_,
+                const int32_t  cycles_)
+{
+  if(!OPERA_PROF_HOT.enabled)
+    return;
+
+  OPERA_PROF_HOT.countdown -= cycles_;
+  if(OPERA_PROF_HOT.countdown > 0)
+    return;
+
+  OPERA_PROF_HOT.countdown += OPERA_PROF_HOT.interval;
+  opera_prof_sample(pc_,lr_);
+}
+
+#define OPERA_PROF_TICK(PC,LR,CYCLES) opera_prof_tick((PC),(LR),(CYCLES))
+#define OPERA_PROF_SWI(SWI)           do { if(OPERA_PROF_HOT.enabled) opera_prof_swi(SWI); } while(0)
+
+#else
+
+static INLINE int   opera_prof_symbols_parse(const char *text_) { return -1; }
+static INLINE int   opera_prof_enable(const uint32_t interval_) { return -1; }
+static INLINE void  opera_prof_disable(void) {}
+static INLINE char *opera_prof_report_flat(void) { return 0; }
+static INLINE char *opera_prof_report_folded(void) { return 0; }
+
+#define OPERA_PROF_TICK(PC,LR,CYCLES)
+#define OPERA_PROF_SWI(SWI)
+
+#endif
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_PROF_H_INCLUDED */
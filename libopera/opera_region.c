@@ -1,6 +1,7 @@
 #include "opera_clock.h"
 
 #include "opera_region_i.h"
+#include "thread_local.h"
 
 #define NTSC_WIDTH 320
 #define NTSC_HEIGHT 240
@@ -23,7 +24,7 @@
 #define PAL2_END_SCANLINE (PAL2_START_SCANLINE + PAL2_HEIGHT)
 #define PAL2_FIELD_RATE 50
 
-opera_region_t g_REGION =
+THREAD_LOCAL opera_region_t g_REGION =
   {
     OPERA_REGION_NTSC,
     NTSC_WIDTH,
@@ -4,10 +4,11 @@
 #include "inline.h"
 
 #include "opera_region_i.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 
-extern opera_region_t g_REGION;
+extern THREAD_LOCAL opera_region_t g_REGION;
 
 void opera_region_set_NTSC(void);
 void opera_region_set_PAL1(void);
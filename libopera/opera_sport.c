@@ -30,6 +30,10 @@
 
 #include "inline.h"
 #include "opera_core.h"
+#include "opera_cpu.h"
+#include "opera_dirty.h"
+#include "opera_hires.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -37,7 +41,8 @@
 #define SPORT_IDX_MASK   0x7FF
 #define SPORT_IDX_SHIFT  7
 #define SPORT_ELEM_COUNT 512
-#define SPORT_BUFSIZE    (SPORT_ELEM_COUNT * sizeof(uint32_t))
+#define SPORT_VRAM_ADDR  0x00200000
+#define SPORT_VRAM_ELEMS ((1024 * 1024) / sizeof(uint32_t))
 
 struct sport_s
 {
@@ -48,8 +53,8 @@ struct sport_s
 
 typedef struct sport_s sport_t;
 
-static sport_t  SPORT = {0};
-static void    *VRAM;
+static THREAD_LOCAL sport_t  SPORT = {0};
+static THREAD_LOCAL void    *VRAM;
 
 void
 opera_sport_init(uint8_t * const vram_)
@@ -63,17 +68,40 @@ opera_sport_set_source(const uint32_t rawidx_)
   SPORT.source = ((rawidx_ & SPORT_IDX_MASK) << SPORT_IDX_SHIFT);
 }
 
+/* the last few page indexes reach past the end of VRAM, that part is dropped */
+static
+INLINE
+uint32_t
+sport_elem_count(const uint32_t idx_)
+{
+  return (((SPORT_VRAM_ELEMS - idx_) < SPORT_ELEM_COUNT) ?
+          (SPORT_VRAM_ELEMS - idx_) :
+          SPORT_ELEM_COUNT);
+}
+
+/* fills leave the page without hires detail */
+static
+INLINE
+void
+sport_filled(const uint32_t idx_,
+             const uint32_t count_)
+{
+  opera_dirty_mark_range(SPORT_VRAM_ADDR + (idx_ << 2),(count_ << 2));
+  opera_hires_flatten(SPORT_VRAM_ADDR + (idx_ << 2),(count_ << 2));
+}
+
 static
 INLINE
 void
 sport_set_color(const uint32_t idx_)
 {
-  int i;
+  uint32_t  count;
   uint32_t *vram = VRAM;
 
-  vram = &vram[idx_];
-  for(i = 0; i < SPORT_ELEM_COUNT; i++)
-    vram[i] = SPORT.color;
+  count = sport_elem_count(idx_);
+  OPERA_CPU.fill32(&vram[idx_],SPORT.color,count);
+
+  sport_filled(idx_,count);
 }
 
 static
@@ -82,12 +110,13 @@ void
 sport_set_color_with_mask(const uint32_t idx_,
                           const uint32_t mask_)
 {
-  int i;
+  uint32_t  count;
   uint32_t *vram = VRAM;
 
-  vram = &vram[idx_];
-  for(i = 0; i < SPORT_ELEM_COUNT; i++)
-    vram[i] = (((vram[i] ^ SPORT.color) & mask_) ^ SPORT.color);
+  count = sport_elem_count(idx_);
+  OPERA_CPU.fill32_mask(&vram[idx_],SPORT.color,mask_,count);
+
+  sport_filled(idx_,count);
 }
 
 static
@@ -96,20 +125,16 @@ void
 sport_memcpy(const uint32_t didx_,
              const uint32_t sidx_)
 {
+  uint32_t  count;
   uint32_t *vram = VRAM;
 
-  memcpy(&vram[didx_],&vram[sidx_],SPORT_BUFSIZE);
-}
+  count = sport_elem_count((didx_ > sidx_) ? didx_ : sidx_);
+  opera_hires_copy(SPORT_VRAM_ADDR + (didx_ << 2),
+                   SPORT_VRAM_ADDR + (sidx_ << 2),
+                   (count << 2));
+  memcpy(&vram[didx_],&vram[sidx_],(count << 2));
 
-static
-INLINE
-void
-sport_memcpy_highres(const uint32_t didx_,
-                     const uint32_t sidx_)
-{
-  sport_memcpy(didx_ + (1*1024*1024/sizeof(uint32_t)),sidx_);
-  sport_memcpy(didx_ + (2*1024*1024/sizeof(uint32_t)),sidx_);
-  sport_memcpy(didx_ + (3*1024*1024/sizeof(uint32_t)),sidx_);
+  opera_dirty_mark_range(SPORT_VRAM_ADDR + (didx_ << 2),(count << 2));
 }
 
 static
@@ -125,11 +150,6 @@ sport_flash_write(const uint32_t rawidx_,
     sport_set_color(idx);
   else
     sport_set_color_with_mask(idx,mask_);
-
-  if(!HIRESMODE)
-    return;
-
-  sport_memcpy_highres(idx,idx);
 }
 
 static
@@ -138,11 +158,6 @@ void
 sport_copy_page_color(void)
 {
   sport_memcpy(SPORT.destination,SPORT.source);
-
-  if(!HIRESMODE)
-    return;
-
-  sport_memcpy_highres(SPORT.destination,SPORT.source);
 }
 
 static
@@ -150,22 +165,22 @@ INLINE
 void
 sport_copy_page_color_with_mask(const uint32_t mask_)
 {
-  int i;
-  uint32_t *vram;
-  uint32_t *svram;
-  uint32_t *dvram;
-
-  vram  = VRAM;
-  svram = &vram[SPORT.source];
-  dvram = &vram[SPORT.destination];
-
-  for(i = 0; i < SPORT_ELEM_COUNT; i++)
-    dvram[i] = (((dvram[i] ^ svram[i]) & mask_) ^ svram[i]);
-
-  if(!HIRESMODE)
-    return;
+  uint32_t  count;
+  uint32_t *vram = VRAM;
 
-  sport_memcpy_highres(SPORT.destination,SPORT.destination);
+  count = sport_elem_count((SPORT.destination > SPORT.source) ?
+                           SPORT.destination :
+                           SPORT.source);
+  opera_hires_copy_mask(SPORT_VRAM_ADDR + (SPORT.destination << 2),
+                        SPORT_VRAM_ADDR + (SPORT.source << 2),
+                        mask_,
+                        (count << 2));
+  OPERA_CPU.copy32_mask(&vram[SPORT.destination],
+                        &vram[SPORT.source],
+                        mask_,
+                        count);
+
+  opera_dirty_mark_range(SPORT_VRAM_ADDR + (SPORT.destination << 2),(count << 2));
 }
 
 static
@@ -0,0 +1,275 @@
+#include "opera_trace.h"
+#include "thread_local.h"
+
+#ifdef OPERA_TRACE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#define TRACE_LOAD(X)      (X)
+#define TRACE_STORE(X,V)   ((X) = (V))
+#define TRACE_CLAIM(P,V)   (InterlockedCompareExchangePointer((PVOID volatile*)(P),(V),NULL) == NULL)
+#else
+#define TRACE_LOAD(X)      __atomic_load_n(&(X),__ATOMIC_ACQUIRE)
+#define TRACE_STORE(X,V)   __atomic_store_n(&(X),(V),__ATOMIC_RELEASE)
+#define TRACE_CLAIM(P,V)   __sync_bool_compare_and_swap((P),NULL,(V))
+#endif
+
+#define TRACE_RING_MASK (OPERA_TRACE_RING_SIZE - 1)
+#define TRACE_LINE_SIZE 256
+
+/*
+  Each ring has exactly one producer (the thread that enabled it) and
+  one consumer (the caller of opera_trace_drain), so head and tail
+  only ever need acquire/release ordering. A thread disabling tracing
+  marks its ring closed and the consumer frees it once emptied.
+*/
+
+struct trace_event_s
+{
+  uint64_t    ts;
+  const char *name;
+  const char *arg_name;
+  uint32_t    arg;
+  uint32_t    phase;
+};
+
+typedef struct trace_event_s trace_event_t;
+
+struct trace_ring_s
+{
+  trace_event_t *events;
+  uint32_t       head;
+  uint32_t       tail;
+  uint32_t       dropped;
+  uint32_t       reported;
+  uint32_t       closed;
+  uint32_t       tid;
+  uint32_t       named;
+};
+
+typedef struct trace_ring_s trace_ring_t;
+
+THREAD_LOCAL int OPERA_TRACE_ENABLED = 0;
+
+static THREAD_LOCAL trace_ring_t *g_TRACE_RING = NULL;
+
+static opera_trace_clock_cb_t g_TRACE_CLOCK = NULL;
+static uint64_t               g_TRACE_EPOCH = 0;
+static trace_ring_t          *g_TRACE_RINGS[OPERA_TRACE_MAX_THREADS];
+
+void
+opera_trace_set_clock(opera_trace_clock_cb_t cb_)
+{
+  g_TRACE_CLOCK = cb_;
+  if(g_TRACE_CLOCK != NULL)
+    g_TRACE_EPOCH = g_TRACE_CLOCK();
+}
+
+int
+opera_trace_enable(void)
+{
+  uint32_t i;
+  trace_ring_t *ring;
+
+  if(g_TRACE_RING != NULL)
+    return 0;
+  if(g_TRACE_CLOCK == NULL)
+    return -1;
+
+  ring = calloc(1,sizeof(trace_ring_t));
+  if(ring == NULL)
+    return -1;
+
+  ring->events = malloc(OPERA_TRACE_RING_SIZE * sizeof(trace_event_t));
+  if(ring->events == NULL)
+    {
+      free(ring);
+      return -1;
+    }
+
+  for(i = 0; i < OPERA_TRACE_MAX_THREADS; i++)
+    {
+      ring->tid = (i + 1);
+      if(TRACE_CLAIM(&g_TRACE_RINGS[i],ring))
+        break;
+    }
+
+  if(i == OPERA_TRACE_MAX_THREADS)
+    {
+      free(ring->events);
+      free(ring);
+      return -1;
+    }
+
+  g_TRACE_RING        = ring;
+  OPERA_TRACE_ENABLED = 1;
+
+  return 0;
+}
+
+void
+opera_trace_disable(void)
+{
+  if(g_TRACE_RING == NULL)
+    return;
+
+  OPERA_TRACE_ENABLED = 0;
+  TRACE_STORE(g_TRACE_RING->closed,1);
+  g_TRACE_RING = NULL;
+}
+
+void
+opera_trace_event(const char                *name_,
+                  const opera_trace_phase_e  phase_,
+                  const char                *arg_name_,
+                  const uint32_t             arg_)
+{
+  uint32_t head;
+  trace_ring_t *ring;
+  trace_event_t *ev;
+
+  ring = g_TRACE_RING;
+  head = ring->head;
+  if((head - TRACE_LOAD(ring->tail)) >= OPERA_TRACE_RING_SIZE)
+    {
+      TRACE_STORE(ring->dropped,ring->dropped + 1);
+      return;
+    }
+
+  ev = &ring->events[head & TRACE_RING_MASK];
+  ev->ts       = (g_TRACE_CLOCK() - g_TRACE_EPOCH);
+  ev->name     = name_;
+  ev->phase    = phase_;
+  ev->arg_name = arg_name_;
+  ev->arg      = arg_;
+
+  TRACE_STORE(ring->head,head + 1);
+}
+
+static
+int
+trace_format(char                *buf_,
+             const uint32_t       tid_,
+             const trace_event_t *ev_)
+{
+  int len;
+
+  len = snprintf(buf_,TRACE_LINE_SIZE,
+                 ",\n{\"name\":\"%s\",\"cat\":\"opera\",\"ph\":\"%c\","
+                 "\"ts\":%llu.%03u,\"pid\":1,\"tid\":%u",
+                 ev_->name,
+                 (char)ev_->phase,
+                 (unsigned long long)(ev_->ts / 1000),
+                 (unsigned)(ev_->ts % 1000),
+                 tid_);
+
+  switch(ev_->phase)
+    {
+    case OPERA_TRACE_PHASE_INSTANT:
+      len += snprintf(&buf_[len],TRACE_LINE_SIZE - len,",\"s\":\"t\"");
+      break;
+    case OPERA_TRACE_PHASE_ASYNC_BEGIN:
+    case OPERA_TRACE_PHASE_ASYNC_END:
+      len += snprintf(&buf_[len],TRACE_LINE_SIZE - len,",\"id\":%u",ev_->arg);
+      break;
+    }
+
+  if(ev_->arg_name != NULL)
+    len += snprintf(&buf_[len],TRACE_LINE_SIZE - len,
+                    ",\"args\":{\"%s\":%u}}",
+                    ev_->arg_name,
+                    ev_->arg);
+  else
+    len += snprintf(&buf_[len],TRACE_LINE_SIZE - len,"}");
+
+  return len;
+}
+
+static
+uint32_t
+trace_drain_ring(trace_ring_t           *ring_,
+                 opera_trace_write_cb_t  cb_,
+                 void                   *ctx_)
+{
+  int len;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t count;
+  uint32_t dropped;
+  char buf[TRACE_LINE_SIZE];
+
+  if(!ring_->named)
+    {
+      len = snprintf(buf,sizeof(buf),
+                     ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                     "\"args\":{\"name\":\"opera %u\"}}",
+                     ring_->tid,
+                     ring_->tid);
+      cb_(ctx_,buf,len);
+      ring_->named = 1;
+    }
+
+  head = TRACE_LOAD(ring_->head);
+  tail = ring_->tail;
+  for(; tail != head; tail++)
+    {
+      len = trace_format(buf,ring_->tid,&ring_->events[tail & TRACE_RING_MASK]);
+      cb_(ctx_,buf,len);
+    }
+
+  /* drops are reported where they were noticed, not where they happened */
+  dropped = TRACE_LOAD(ring_->dropped);
+  if(dropped != ring_->reported)
+    {
+      trace_event_t ev;
+
+      ev.ts       = (g_TRACE_CLOCK() - g_TRACE_EPOCH);
+      ev.name     = "trace dropped";
+      ev.phase    = OPERA_TRACE_PHASE_INSTANT;
+      ev.arg_name = "events";
+      ev.arg      = (dropped - ring_->reported);
+
+      len = trace_format(buf,ring_->tid,&ev);
+      cb_(ctx_,buf,len);
+      ring_->reported = dropped;
+    }
+
+  count = (head - ring_->tail);
+  TRACE_STORE(ring_->tail,tail);
+
+  return count;
+}
+
+uint32_t
+opera_trace_drain(opera_trace_write_cb_t  cb_,
+                  void                   *ctx_)
+{
+  uint32_t i;
+  uint32_t count;
+  trace_ring_t *ring;
+
+  count = 0;
+  for(i = 0; i < OPERA_TRACE_MAX_THREADS; i++)
+    {
+      ring = TRACE_LOAD(g_TRACE_RINGS[i]);
+      if(ring == NULL)
+        continue;
+
+      count += trace_drain_ring(ring,cb_,ctx_);
+
+      if(TRACE_LOAD(ring->closed) &&
+         (TRACE_LOAD(ring->head) == ring->tail))
+        {
+          TRACE_STORE(g_TRACE_RINGS[i],NULL);
+          free(ring->events);
+          free(ring);
+        }
+    }
+
+  return count;
+}
+
+#endif
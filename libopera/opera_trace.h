@@ -0,0 +1,83 @@
+#ifndef LIBOPERA_TRACE_H_INCLUDED
+#define LIBOPERA_TRACE_H_INCLUDED
+
+#include "extern_c.h"
+#include "inline.h"
+#include "thread_local.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Timeline tracer. Events are appended to a ring owned by the calling
+  thread without taking locks and are turned into Chrome trace event
+  JSON ("Trace Event Format", also read by Perfetto) by whoever calls
+  opera_trace_drain(), normally a writer thread in the frontend glue.
+  Names must be string literals as only the pointer is stored. When
+  the ring is full new events are dropped and counted. The host
+  supplies a nanosecond clock. Built without OPERA_TRACE the hooks
+  compile away.
+*/
+
+#define OPERA_TRACE_RING_SIZE   (1 << 16)
+#define OPERA_TRACE_MAX_THREADS 16
+
+enum opera_trace_phase_e
+  {
+    OPERA_TRACE_PHASE_BEGIN       = 'B',
+    OPERA_TRACE_PHASE_END         = 'E',
+    OPERA_TRACE_PHASE_INSTANT     = 'i',
+    OPERA_TRACE_PHASE_ASYNC_BEGIN = 'b',
+    OPERA_TRACE_PHASE_ASYNC_END   = 'e'
+  };
+
+typedef enum opera_trace_phase_e opera_trace_phase_e;
+
+typedef uint64_t (*opera_trace_clock_cb_t)(void);
+typedef void (*opera_trace_write_cb_t)(void       *ctx_,
+                                       const char *str_,
+                                       size_t      len_);
+
+EXTERN_C_BEGIN
+
+#ifdef OPERA_TRACE
+
+extern THREAD_LOCAL int OPERA_TRACE_ENABLED;
+
+void     opera_trace_set_clock(opera_trace_clock_cb_t cb_);
+int      opera_trace_enable(void);
+void     opera_trace_disable(void);
+
+void     opera_trace_event(const char                *name_,
+                           const opera_trace_phase_e  phase_,
+                           const char                *arg_name_,
+                           const uint32_t             arg_);
+
+uint32_t opera_trace_drain(opera_trace_write_cb_t  cb_,
+                           void                   *ctx_);
+
+#define OPERA_TRACE_EVENT(NAME,PHASE,ARGNAME,ARG)                   \
+  do { if(OPERA_TRACE_ENABLED)                                      \
+      opera_trace_event((NAME),(PHASE),(ARGNAME),(ARG)); } while(0)
+
+#else
+
+static INLINE void     opera_trace_set_clock(opera_trace_clock_cb_t cb_) {}
+static INLINE int      opera_trace_enable(void) { return -1; }
+static INLINE void     opera_trace_disable(void) {}
+static INLINE uint32_t opera_trace_drain(opera_trace_write_cb_t cb_, void *ctx_) { return 0; }
+
+#define OPERA_TRACE_EVENT(NAME,PHASE,ARGNAME,ARG) ((void)(ARG))
+
+#endif
+
+#define OPERA_TRACE_BEGIN(NAME)               OPERA_TRACE_EVENT(NAME,OPERA_TRACE_PHASE_BEGIN,NULL,0)
+#define OPERA_TRACE_END(NAME)                 OPERA_TRACE_EVENT(NAME,OPERA_TRACE_PHASE_END,NULL,0)
+#define OPERA_TRACE_END_ARG(NAME,ARGNAME,ARG) OPERA_TRACE_EVENT(NAME,OPERA_TRACE_PHASE_END,ARGNAME,ARG)
+#define OPERA_TRACE_INSTANT(NAME,ARGNAME,ARG) OPERA_TRACE_EVENT(NAME,OPERA_TRACE_PHASE_INSTANT,ARGNAME,ARG)
+#define OPERA_TRACE_ASYNC_BEGIN(NAME,ID)      OPERA_TRACE_EVENT(NAME,OPERA_TRACE_PHASE_ASYNC_BEGIN,NULL,ID)
+#define OPERA_TRACE_ASYNC_END(NAME,ID)        OPERA_TRACE_EVENT(NAME,OPERA_TRACE_PHASE_ASYNC_END,NULL,ID)
+
+EXTERN_C_END
+
+#endif /* LIBOPERA_TRACE_H_INCLUDED */
@@ -1,12 +1,16 @@
+#include "cache_aligned.h"
 #include "hack_flags.h"
 #include "inline.h"
 
 #include "opera_arm.h"
 #include "opera_core.h"
+#include "opera_cpu.h"
+#include "opera_hires.h"
 #include "opera_region.h"
 #include "opera_vdl.h"
 #include "opera_vdlp.h"
 #include "opera_vdlp_i.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -18,11 +22,13 @@
   - add pseudo random 3bit pattern for second clut bypass mode
 */
 
-static vdlp_t   g_VDLP          = {0};
-static uint8_t *g_VRAM          = NULL;
-static void    *g_BUF           = NULL;
-static void    *g_CURBUF        = NULL;
-static void (*g_RENDERER)(void) = NULL;
+static THREAD_LOCAL CACHE_ALIGNED vdlp_t g_VDLP = {0};
+static THREAD_LOCAL uint8_t *g_VRAM          = NULL;
+static THREAD_LOCAL void    *g_BUF           = NULL;
+static THREAD_LOCAL void    *g_CURBUF        = NULL;
+static THREAD_LOCAL uint32_t g_PITCH         = 0;
+static THREAD_LOCAL void (*g_RENDERER)(void) = NULL;
+static THREAD_LOCAL int      g_SKIP          = 0;
 
 static const uint32_t PIXELS_PER_LINE_MODULO[8] =
   {320, 384, 512, 640, 1024, 320, 320, 320};
@@ -44,6 +50,29 @@ vram_write32(const uint32_t addr_,
   *((uint32_t*)&g_VRAM[addr_]) = val_;
 }
 
+/*
+  The 2x2 sub-pixels behind one VRAM pixel. Pages without hires
+  detail replicate VRAM, see opera_hires.h.
+*/
+static
+INLINE
+void
+vdlp_hires_fetch(uint16_t        p_[4],
+                 const uint32_t *src_,
+                 const uint32_t  off_)
+{
+  p_[0] = *(const uint16_t*)src_;
+  if(!opera_hires_is_detailed(off_))
+    {
+      p_[1] = p_[2] = p_[3] = p_[0];
+      return;
+    }
+
+  p_[1] = *(const uint16_t*)opera_hires_plane(1,off_);
+  p_[2] = *(const uint16_t*)opera_hires_plane(2,off_);
+  p_[3] = *(const uint16_t*)opera_hires_plane(3,off_);
+}
+
 static
 INLINE
 uint32_t
@@ -154,6 +183,42 @@ vdlp_process_vdl_entry(void)
   g_VDLP.line_cnt = cdcw->persist_len;
 }
 
+/*
+  Rows are packed unless the output buffer came with a pitch. Lines
+  are then clipped to the row and the rest of the row cleared as a
+  frontend's framebuffer starts out undefined. end_ is one past the
+  len_ bytes just written to the current row, returns the next row.
+*/
+static
+INLINE
+void*
+vdlp_row_next(void           *end_,
+              const uint32_t  len_)
+{
+  uint8_t *end = end_;
+
+  if(!g_PITCH)
+    return end;
+
+  memset(end,0,g_PITCH - len_);
+
+  return (end - len_ + g_PITCH);
+}
+
+static
+INLINE
+int
+vdlp_line_width(const uint32_t bytes_per_pixel_)
+{
+  uint32_t width;
+
+  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  if(g_PITCH && ((width * bytes_per_pixel_) > g_PITCH))
+    width = (g_PITCH / bytes_per_pixel_);
+
+  return width;
+}
+
 static
 void
 vdlp_render_line_black(const uint32_t width_,
@@ -167,7 +232,7 @@ vdlp_render_line_black(const uint32_t width_,
 
   memset(dst,0,len);
 
-  g_CURBUF = (dst + len);
+  g_CURBUF = vdlp_row_next(dst + len,len);
 }
 
 static
@@ -179,11 +244,13 @@ vdlp_render_line_black_hires(const uint32_t width_,
   uint32_t len;
 
   dst = g_CURBUF;
-  len = (width_ * bytes_per_pixel_ * 2 * 2);
+  len = (width_ * bytes_per_pixel_ * 2);
 
+  memset(dst,0,len);
+  dst = vdlp_row_next(dst + len,len);
   memset(dst,0,len);
 
-  g_CURBUF = (dst + len);
+  g_CURBUF = vdlp_row_next(dst + len,len);
 }
 
 static
@@ -243,7 +310,7 @@ vdlp_render_line_0RGB1555(void)
   uint32_t *src;
   uint16_t *dst;
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black(width,sizeof(uint16_t));
 
@@ -260,28 +327,26 @@ vdlp_render_line_0RGB1555(void)
         dst[x] = vdlp_render_pixel_0RGB1555_bypass_clut(*(uint16_t*)&src[x]);
     }
 
-  g_CURBUF = (dst + width);
+  g_CURBUF = vdlp_row_next(dst + width,width * sizeof(uint16_t));
 }
 
 static
 void
 vdlp_render_line_0RGB1555_bypass_clut(void)
 {
-  int x;
   int width;
   uint32_t *src;
   uint16_t *dst;
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black(width,sizeof(uint16_t));
 
   dst = g_CURBUF;
   src = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  for(x = 0; x < width; x++)
-    dst[x] = fixed_clut_to_0RGB1555(*(uint16_t*)&src[x]);
+  OPERA_CPU.vdlp_0rgb1555(dst,src,width);
 
-  g_CURBUF = (dst + width);
+  g_CURBUF = vdlp_row_next(dst + width,width * sizeof(uint16_t));
 }
 
 static
@@ -293,42 +358,41 @@ vdlp_render_line_0RGB1555_hires(void)
   uint16_t *dst0;
   uint16_t *dst1;
   uint32_t *src0;
-  uint32_t *src1;
-  uint32_t *src2;
-  uint32_t *src3;
+  uint32_t off;
+  uint16_t p[4];
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(2 * sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
-    return vdlp_render_line_black(width,sizeof(uint16_t));
+    return vdlp_render_line_black_hires(width,sizeof(uint16_t));
 
   dst0 = g_CURBUF;
-  dst1 = (dst0 + (width << 1));
-  src0 = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  src1 = (src0 + ((1024 * 1024) / sizeof(uint32_t)));
-  src2 = (src1 + ((1024 * 1024) / sizeof(uint32_t)));
-  src3 = (src2 + ((1024 * 1024) / sizeof(uint32_t)));
+  dst1 = vdlp_row_next(dst0 + (width << 1),width * 2 * sizeof(uint16_t));
+  off  = ((g_VDLP.curr_bmp^2) & 0x0FFFFF);
+  src0 = (uint32_t*)(g_VRAM + off);
   if(!g_VDLP.disp_ctrl.dcw.clut_bypass)
     {
       for(x = 0; x < width; x++)
         {
-          *dst0++ = vdlp_render_pixel_0RGB1555(*(uint16_t*)&src0[x]);
-          *dst0++ = vdlp_render_pixel_0RGB1555(*(uint16_t*)&src1[x]);
-          *dst1++ = vdlp_render_pixel_0RGB1555(*(uint16_t*)&src2[x]);
-          *dst1++ = vdlp_render_pixel_0RGB1555(*(uint16_t*)&src3[x]);
+          vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+          *dst0++ = vdlp_render_pixel_0RGB1555(p[0]);
+          *dst0++ = vdlp_render_pixel_0RGB1555(p[1]);
+          *dst1++ = vdlp_render_pixel_0RGB1555(p[2]);
+          *dst1++ = vdlp_render_pixel_0RGB1555(p[3]);
         }
     }
   else
     {
       for(x = 0; x < width; x++)
         {
-          *dst0++ = vdlp_render_pixel_0RGB1555_bypass_clut(*(uint16_t*)&src0[x]);
-          *dst0++ = vdlp_render_pixel_0RGB1555_bypass_clut(*(uint16_t*)&src1[x]);
-          *dst1++ = vdlp_render_pixel_0RGB1555_bypass_clut(*(uint16_t*)&src2[x]);
-          *dst1++ = vdlp_render_pixel_0RGB1555_bypass_clut(*(uint16_t*)&src3[x]);
+          vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+          *dst0++ = vdlp_render_pixel_0RGB1555_bypass_clut(p[0]);
+          *dst0++ = vdlp_render_pixel_0RGB1555_bypass_clut(p[1]);
+          *dst1++ = vdlp_render_pixel_0RGB1555_bypass_clut(p[2]);
+          *dst1++ = vdlp_render_pixel_0RGB1555_bypass_clut(p[3]);
         }
     }
 
-  g_CURBUF = dst1;
+  g_CURBUF = vdlp_row_next(dst1,width * 2 * sizeof(uint16_t));
 }
 
 static
@@ -340,29 +404,27 @@ vdlp_render_line_0RGB1555_hires_bypass_clut(void)
   uint16_t *dst0;
   uint16_t *dst1;
   uint32_t *src0;
-  uint32_t *src1;
-  uint32_t *src2;
-  uint32_t *src3;
+  uint32_t off;
+  uint16_t p[4];
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(2 * sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
-    return vdlp_render_line_black(width,sizeof(uint16_t));
+    return vdlp_render_line_black_hires(width,sizeof(uint16_t));
 
   dst0 = g_CURBUF;
-  dst1 = (dst0 + (width << 1));
-  src0 = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  src1 = (src0 + ((1024 * 1024) / sizeof(uint32_t)));
-  src2 = (src1 + ((1024 * 1024) / sizeof(uint32_t)));
-  src3 = (src2 + ((1024 * 1024) / sizeof(uint32_t)));
+  dst1 = vdlp_row_next(dst0 + (width << 1),width * 2 * sizeof(uint16_t));
+  off  = ((g_VDLP.curr_bmp^2) & 0x0FFFFF);
+  src0 = (uint32_t*)(g_VRAM + off);
   for(x = 0; x < width; x++)
     {
-      *dst0++ = fixed_clut_to_0RGB1555(*(uint16_t*)&src0[x]);
-      *dst0++ = fixed_clut_to_0RGB1555(*(uint16_t*)&src1[x]);
-      *dst1++ = fixed_clut_to_0RGB1555(*(uint16_t*)&src2[x]);
-      *dst1++ = fixed_clut_to_0RGB1555(*(uint16_t*)&src3[x]);
+      vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+      *dst0++ = fixed_clut_to_0RGB1555(p[0]);
+      *dst0++ = fixed_clut_to_0RGB1555(p[1]);
+      *dst1++ = fixed_clut_to_0RGB1555(p[2]);
+      *dst1++ = fixed_clut_to_0RGB1555(p[3]);
     }
 
-  g_CURBUF = dst1;
+  g_CURBUF = vdlp_row_next(dst1,width * 2 * sizeof(uint16_t));
 }
 
 static
@@ -422,7 +484,7 @@ vdlp_render_line_RGB565(void)
   uint32_t *src;
   uint16_t *dst;
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black(width,sizeof(uint16_t));
 
@@ -439,28 +501,26 @@ vdlp_render_line_RGB565(void)
         dst[x] = vdlp_render_pixel_RGB565_bypass_clut(*(uint16_t*)&src[x]);
     }
 
-  g_CURBUF = (dst + width);
+  g_CURBUF = vdlp_row_next(dst + width,width * sizeof(uint16_t));
 }
 
 static
 void
 vdlp_render_line_RGB565_bypass_clut(void)
 {
-  int x;
   int width;
   uint32_t *src;
   uint16_t *dst;
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black(width,sizeof(uint16_t));
 
   dst = g_CURBUF;
   src = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  for(x = 0; x < width; x++)
-    dst[x] = fixed_clut_to_RGB565(*(uint16_t*)&src[x]);
+  OPERA_CPU.vdlp_rgb565(dst,src,width);
 
-  g_CURBUF = (dst + width);
+  g_CURBUF = vdlp_row_next(dst + width,width * sizeof(uint16_t));
 }
 
 static
@@ -472,42 +532,41 @@ vdlp_render_line_RGB565_hires(void)
   uint16_t *dst0;
   uint16_t *dst1;
   uint32_t *src0;
-  uint32_t *src1;
-  uint32_t *src2;
-  uint32_t *src3;
+  uint32_t off;
+  uint16_t p[4];
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(2 * sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black_hires(width,sizeof(uint16_t));
 
   dst0 = g_CURBUF;
-  dst1 = (dst0 + (width << 1));
-  src0 = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  src1 = (src0 + ((1024 * 1024) / sizeof(uint32_t)));
-  src2 = (src1 + ((1024 * 1024) / sizeof(uint32_t)));
-  src3 = (src2 + ((1024 * 1024) / sizeof(uint32_t)));
+  dst1 = vdlp_row_next(dst0 + (width << 1),width * 2 * sizeof(uint16_t));
+  off  = ((g_VDLP.curr_bmp^2) & 0x0FFFFF);
+  src0 = (uint32_t*)(g_VRAM + off);
   if(!g_VDLP.disp_ctrl.dcw.clut_bypass)
     {
       for(x = 0; x < width; x++)
         {
-          *dst0++ = vdlp_render_pixel_RGB565(*(uint16_t*)&src0[x]);
-          *dst0++ = vdlp_render_pixel_RGB565(*(uint16_t*)&src1[x]);
-          *dst1++ = vdlp_render_pixel_RGB565(*(uint16_t*)&src2[x]);
-          *dst1++ = vdlp_render_pixel_RGB565(*(uint16_t*)&src3[x]);
+          vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+          *dst0++ = vdlp_render_pixel_RGB565(p[0]);
+          *dst0++ = vdlp_render_pixel_RGB565(p[1]);
+          *dst1++ = vdlp_render_pixel_RGB565(p[2]);
+          *dst1++ = vdlp_render_pixel_RGB565(p[3]);
         }
     }
   else
     {
       for(x = 0; x < width; x++)
         {
-          *dst0++ = vdlp_render_pixel_RGB565_bypass_clut(*(uint16_t*)&src0[x]);
-          *dst0++ = vdlp_render_pixel_RGB565_bypass_clut(*(uint16_t*)&src1[x]);
-          *dst1++ = vdlp_render_pixel_RGB565_bypass_clut(*(uint16_t*)&src2[x]);
-          *dst1++ = vdlp_render_pixel_RGB565_bypass_clut(*(uint16_t*)&src3[x]);
+          vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+          *dst0++ = vdlp_render_pixel_RGB565_bypass_clut(p[0]);
+          *dst0++ = vdlp_render_pixel_RGB565_bypass_clut(p[1]);
+          *dst1++ = vdlp_render_pixel_RGB565_bypass_clut(p[2]);
+          *dst1++ = vdlp_render_pixel_RGB565_bypass_clut(p[3]);
         }
     }
 
-  g_CURBUF = dst1;
+  g_CURBUF = vdlp_row_next(dst1,width * 2 * sizeof(uint16_t));
 }
 
 static
@@ -519,29 +578,27 @@ vdlp_render_line_RGB565_hires_bypass_clut(void)
   uint16_t *dst0;
   uint16_t *dst1;
   uint32_t *src0;
-  uint32_t *src1;
-  uint32_t *src2;
-  uint32_t *src3;
+  uint32_t off;
+  uint16_t p[4];
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(2 * sizeof(uint16_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black_hires(width,sizeof(uint16_t));
 
   dst0 = g_CURBUF;
-  dst1 = (dst0 + (width << 1));
-  src0 = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  src1 = (src0 + ((1024 * 1024) / sizeof(uint32_t)));
-  src2 = (src1 + ((1024 * 1024) / sizeof(uint32_t)));
-  src3 = (src2 + ((1024 * 1024) / sizeof(uint32_t)));
+  dst1 = vdlp_row_next(dst0 + (width << 1),width * 2 * sizeof(uint16_t));
+  off  = ((g_VDLP.curr_bmp^2) & 0x0FFFFF);
+  src0 = (uint32_t*)(g_VRAM + off);
   for(x = 0; x < width; x++)
     {
-      *dst0++ = fixed_clut_to_RGB565(*(uint16_t*)&src0[x]);
-      *dst0++ = fixed_clut_to_RGB565(*(uint16_t*)&src1[x]);
-      *dst1++ = fixed_clut_to_RGB565(*(uint16_t*)&src2[x]);
-      *dst1++ = fixed_clut_to_RGB565(*(uint16_t*)&src3[x]);
+      vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+      *dst0++ = fixed_clut_to_RGB565(p[0]);
+      *dst0++ = fixed_clut_to_RGB565(p[1]);
+      *dst1++ = fixed_clut_to_RGB565(p[2]);
+      *dst1++ = fixed_clut_to_RGB565(p[3]);
     }
 
-  g_CURBUF = dst1;
+  g_CURBUF = vdlp_row_next(dst1,width * 2 * sizeof(uint16_t));
 }
 
 static
@@ -594,7 +651,7 @@ vdlp_render_line_XRGB8888(void)
   uint32_t *src;
   uint32_t *dst;
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(sizeof(uint32_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black(width,sizeof(uint32_t));
 
@@ -611,28 +668,26 @@ vdlp_render_line_XRGB8888(void)
         dst[x] = vdlp_render_pixel_XRGB8888_bypass_clut(*(uint16_t*)&src[x]);
     }
 
-  g_CURBUF = (dst + width);
+  g_CURBUF = vdlp_row_next(dst + width,width * sizeof(uint32_t));
 }
 
 static
 void
 vdlp_render_line_XRGB8888_bypass_clut(void)
 {
-  int x;
   int width;
   uint32_t *src;
   uint32_t *dst;
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(sizeof(uint32_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black(width,sizeof(uint32_t));
 
   dst = g_CURBUF;
   src = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  for(x = 0; x < width; x++)
-    dst[x] = fixed_clut_to_XRGB8888(*(uint16_t*)&src[x]);
+  OPERA_CPU.vdlp_xrgb8888(dst,src,width);
 
-  g_CURBUF = (dst + width);
+  g_CURBUF = vdlp_row_next(dst + width,width * sizeof(uint32_t));
 }
 
 static
@@ -644,42 +699,41 @@ vdlp_render_line_XRGB8888_hires(void)
   uint32_t *dst0;
   uint32_t *dst1;
   uint32_t *src0;
-  uint32_t *src1;
-  uint32_t *src2;
-  uint32_t *src3;
+  uint32_t off;
+  uint16_t p[4];
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(2 * sizeof(uint32_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black_hires(width,sizeof(uint32_t));
 
   dst0 = g_CURBUF;
-  dst1 = (dst0 + (width << 1));
-  src0 = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  src1 = (src0 + ((1024 * 1024) / sizeof(uint32_t)));
-  src2 = (src1 + ((1024 * 1024) / sizeof(uint32_t)));
-  src3 = (src2 + ((1024 * 1024) / sizeof(uint32_t)));
+  dst1 = vdlp_row_next(dst0 + (width << 1),width * 2 * sizeof(uint32_t));
+  off  = ((g_VDLP.curr_bmp^2) & 0x0FFFFF);
+  src0 = (uint32_t*)(g_VRAM + off);
   if(!g_VDLP.disp_ctrl.dcw.clut_bypass)
     {
       for(x = 0; x < width; x++)
         {
-          *dst0++ = vdlp_render_pixel_XRGB8888(*(uint16_t*)&src0[x]);
-          *dst0++ = vdlp_render_pixel_XRGB8888(*(uint16_t*)&src1[x]);
-          *dst1++ = vdlp_render_pixel_XRGB8888(*(uint16_t*)&src2[x]);
-          *dst1++ = vdlp_render_pixel_XRGB8888(*(uint16_t*)&src3[x]);
+          vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+          *dst0++ = vdlp_render_pixel_XRGB8888(p[0]);
+          *dst0++ = vdlp_render_pixel_XRGB8888(p[1]);
+          *dst1++ = vdlp_render_pixel_XRGB8888(p[2]);
+          *dst1++ = vdlp_render_pixel_XRGB8888(p[3]);
         }
     }
   else
     {
       for(x = 0; x < width; x++)
         {
-          *dst0++ = vdlp_render_pixel_XRGB8888_bypass_clut(*(uint16_t*)&src0[x]);
-          *dst0++ = vdlp_render_pixel_XRGB8888_bypass_clut(*(uint16_t*)&src1[x]);
-          *dst1++ = vdlp_render_pixel_XRGB8888_bypass_clut(*(uint16_t*)&src2[x]);
-          *dst1++ = vdlp_render_pixel_XRGB8888_bypass_clut(*(uint16_t*)&src3[x]);
+          vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+          *dst0++ = vdlp_render_pixel_XRGB8888_bypass_clut(p[0]);
+          *dst0++ = vdlp_render_pixel_XRGB8888_bypass_clut(p[1]);
+          *dst1++ = vdlp_render_pixel_XRGB8888_bypass_clut(p[2]);
+          *dst1++ = vdlp_render_pixel_XRGB8888_bypass_clut(p[3]);
         }
     }
 
-  g_CURBUF = dst1;
+  g_CURBUF = vdlp_row_next(dst1,width * 2 * sizeof(uint32_t));
 }
 
 static
@@ -691,29 +745,27 @@ vdlp_render_line_XRGB8888_hires_bypass_clut(void)
   uint32_t *dst0;
   uint32_t *dst1;
   uint32_t *src0;
-  uint32_t *src1;
-  uint32_t *src2;
-  uint32_t *src3;
+  uint32_t off;
+  uint16_t p[4];
 
-  width = PIXELS_PER_LINE_MODULO[g_VDLP.clut_ctrl.cdcw.fba_incr_modulo];
+  width = vdlp_line_width(2 * sizeof(uint32_t));
   if(!g_VDLP.clut_ctrl.cdcw.enable_dma)
     return vdlp_render_line_black_hires(width,sizeof(uint32_t));
 
   dst0 = g_CURBUF;
-  dst1 = (dst0 + (width << 1));
-  src0 = (uint32_t*)(g_VRAM + ((g_VDLP.curr_bmp^2) & 0x0FFFFF));
-  src1 = (src0 + ((1024 * 1024) / sizeof(uint32_t)));
-  src2 = (src1 + ((1024 * 1024) / sizeof(uint32_t)));
-  src3 = (src2 + ((1024 * 1024) / sizeof(uint32_t)));
+  dst1 = vdlp_row_next(dst0 + (width << 1),width * 2 * sizeof(uint32_t));
+  off  = ((g_VDLP.curr_bmp^2) & 0x0FFFFF);
+  src0 = (uint32_t*)(g_VRAM + off);
   for(x = 0; x < width; x++)
     {
-      *dst0++ = fixed_clut_to_XRGB8888(*(uint16_t*)&src0[x]);
-      *dst0++ = fixed_clut_to_XRGB8888(*(uint16_t*)&src1[x]);
-      *dst1++ = fixed_clut_to_XRGB8888(*(uint16_t*)&src2[x]);
-      *dst1++ = fixed_clut_to_XRGB8888(*(uint16_t*)&src3[x]);
+      vdlp_hires_fetch(p,&src0[x],off + (x << 2));
+      *dst0++ = fixed_clut_to_XRGB8888(p[0]);
+      *dst0++ = fixed_clut_to_XRGB8888(p[1]);
+      *dst1++ = fixed_clut_to_XRGB8888(p[2]);
+      *dst1++ = fixed_clut_to_XRGB8888(p[3]);
     }
 
-  g_CURBUF = dst1;
+  g_CURBUF = vdlp_row_next(dst1,width * 2 * sizeof(uint32_t));
 }
 
 
@@ -764,7 +816,7 @@ opera_vdlp_process_line(int line_)
   if(g_VDLP.line_cnt == 0)
     vdlp_process_vdl_entry();
 
-  if(visible_scanline(line_))
+  if(visible_scanline(line_) && !g_SKIP)
     g_RENDERER();
 
   g_VDLP.prev_bmp = ((g_VDLP.clut_ctrl.cdcw.prev_fba_tick) ?
@@ -804,6 +856,16 @@ opera_vdlp_init(uint8_t *vram_)
     vram_write32((0xB0000 + (i * sizeof(uint32_t))),StartupVDL[i]);
 }
 
+/*
+  Skipping only drops the conversion to the output buffer. The VDL is
+  still walked so CLUT and display control state stay current.
+*/
+void
+opera_vdlp_set_skip(const int skip_)
+{
+  g_SKIP = skip_;
+}
+
 void
 opera_vdlp_set_vdl_head(const uint32_t addr_)
 {
@@ -819,13 +881,13 @@ opera_vdlp_state_size(void)
 void
 opera_vdlp_state_save(void *buf_)
 {
-  //memcpy(buf_,&vdl,sizeof(vdlp_datum_t));
+  memcpy(buf_,&g_VDLP,sizeof(vdlp_t));
 }
 
 void
 opera_vdlp_state_load(const void *buf_)
 {
-  //memcpy(&vdl,buf_,sizeof(vdlp_datum_t));
+  memcpy(&g_VDLP,buf_,sizeof(vdlp_t));
 }
 
 /*
@@ -888,7 +950,8 @@ opera_vdlp_configure(void                *buf_,
                      vdlp_pixel_format_e  pf_,
                      uint32_t             flags_)
 {
-  g_BUF = buf_;
+  g_BUF   = buf_;
+  g_PITCH = 0;
 
   g_RENDERER = get_renderer(pf_,flags_);
   if(g_RENDERER)
@@ -896,3 +959,16 @@ opera_vdlp_configure(void                *buf_,
 
   return 0;
 }
+
+/*
+  Redirects output for the coming frame, typically to a frontend owned
+  framebuffer. pitch_ is the byte distance between output rows, 0
+  packs them as opera_vdlp_configure() does.
+*/
+void
+opera_vdlp_set_buffer(void           *buf_,
+                      const uint32_t  pitch_)
+{
+  g_BUF   = buf_;
+  g_PITCH = pitch_;
+}
@@ -25,6 +25,7 @@ EXTERN_C_BEGIN
 void     opera_vdlp_init(uint8_t *vram_);
 
 void     opera_vdlp_set_vdl_head(const uint32_t addr);
+void     opera_vdlp_set_skip(const int skip);
 void     opera_vdlp_process_line(int line);
 
 uint32_t opera_vdlp_state_size(void);
@@ -34,6 +35,8 @@ void     opera_vdlp_state_load(const void *buf);
 int      opera_vdlp_configure(void *buf,
                               vdlp_pixel_format_e pf,
                               uint32_t flags);
+void     opera_vdlp_set_buffer(void *buf,
+                               const uint32_t pitch);
 
 EXTERN_C_END
 
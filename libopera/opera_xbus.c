@@ -30,6 +30,7 @@
 
 #include "opera_clio.h"
 #include "opera_xbus.h"
+#include "thread_local.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -57,8 +58,8 @@ struct xbus_datum_s
 
 typedef struct xbus_datum_s xbus_datum_t;
 
-static xbus_datum_t      XBUS;
-static opera_xbus_device xdev[16];
+static THREAD_LOCAL xbus_datum_t      XBUS;
+static THREAD_LOCAL opera_xbus_device xdev[16];
 
 void
 xbus_execute_command_f(void)
@@ -203,6 +204,22 @@ opera_xbus_set_poll(const uint32_t val_)
     }
 }
 
+void
+opera_xbus_tick(const uint32_t cycles_)
+{
+  int i;
+
+  for(i = 0; i < 15; i++)
+    {
+      if(!xdev[i])
+        continue;
+      if(!xdev[i](XBP_TICK,(void*)(uintptr_t)cycles_))
+        continue;
+      if(xdev[i](XBP_FIQ,NULL))
+        opera_clio_fiq_generate(4,0);
+    }
+}
+
 void
 opera_xbus_set_sel(uint32_t val_)
 {
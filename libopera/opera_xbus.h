@@ -45,6 +45,7 @@
 #define XBP_SELECT	 9      //selects device by Opera
 #define XBP_RESERV	 10     //reserved reading from device
 #define XBP_DESTROY	 11     //plugin destroy
+#define XBP_TICK	 12     //advance device by CPU cycles, returns TRUE on event
 #define XBP_GET_SAVESIZE 19	//save support from emulator side
 #define XBP_GET_SAVEDATA 20
 #define XBP_SET_SAVEDATA 21
@@ -73,6 +74,8 @@ uint32_t opera_xbus_fifo_get_status(void);
 void     opera_xbus_fifo_set_data(const uint32_t val_);
 uint32_t opera_xbus_fifo_get_data(void);
 
+void     opera_xbus_tick(const uint32_t cycles_);
+
 uint32_t opera_xbus_state_size(void);
 void     opera_xbus_state_save(void *buf_);
 void     opera_xbus_state_load(const void *buf_);
@@ -2,10 +2,11 @@
 
 #include "opera_cdrom.h"
 #include "opera_xbus.h"
+#include "thread_local.h"
 
 #include <string.h>
 
-static cdrom_device_t g_CDROM_DEVICE = {0};
+static THREAD_LOCAL cdrom_device_t g_CDROM_DEVICE = {0};
 
 void*
 xbus_cdrom_plugin(int   proc_,
@@ -26,6 +27,8 @@ xbus_cdrom_plugin(int   proc_,
       break;
     case XBP_FIQ:
       return (void*)opera_cdrom_test_fiq(&g_CDROM_DEVICE);
+    case XBP_TICK:
+      return (void*)(uintptr_t)opera_cdrom_tick(&g_CDROM_DEVICE,(uint32_t)(uintptr_t)data_);
     case XBP_GET_DATA:
       return (void*)(uintptr_t)opera_cdrom_fifo_get_data(&g_CDROM_DEVICE);
     case XBP_GET_STATUS:
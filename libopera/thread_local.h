@@ -0,0 +1,28 @@
+#ifndef LIBOPERA_THREAD_LOCAL_H_INCLUDED
+#define LIBOPERA_THREAD_LOCAL_H_INCLUDED
+
+/*
+  When built with OPERA_MULTI_INSTANCE all mutable emulator state is
+  thread local: every thread that calls opera_3do_init() owns an
+  independent 3DO, including its callbacks and CD-ROM hooks. Read only
+  tables remain shared. Without it the storage class is empty and
+  nothing changes for the single instance build.
+*/
+
+#ifndef THREAD_LOCAL
+
+#if !defined(OPERA_MULTI_INSTANCE)
+#define THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+#define THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define THREAD_LOCAL __thread
+#else
+#error "OPERA_MULTI_INSTANCE requires thread local storage"
+#endif
+
+#endif /* THREAD_LOCAL */
+
+#endif /* LIBOPERA_THREAD_LOCAL_H_INCLUDED */
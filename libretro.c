@@ -1,22 +1,33 @@
 #include "libopera/hack_flags.h"
 #include "libopera/opera_3do.h"
+#include "libopera/opera_arena.h"
 #include "libopera/opera_arm.h"
 #include "libopera/opera_bios.h"
 #include "libopera/opera_cdrom.h"
 #include "libopera/opera_clock.h"
 #include "libopera/opera_core.h"
+#include "libopera/opera_hires.h"
 #include "libopera/opera_madam.h"
 #include "libopera/opera_pbus.h"
 #include "libopera/opera_region.h"
+#include "libopera/opera_trace.h"
 #include "libopera/opera_vdlp.h"
 
+#include "lr_cdrom.h"
 #include "lr_dsp.h"
+#include "lr_frameskip.h"
 #include "lr_input.h"
 #include "lr_input_crosshair.h"
 #include "lr_input_descs.h"
+#include "lr_perf.h"
+#include "lr_prof.h"
+#include "lr_rewind.h"
+#include "lr_runahead.h"
+#include "lr_trace.h"
 #include "nvram.h"
 #include "retro_callbacks.h"
 #include "retro_cdimage.h"
+#include "retro_cdimage_index.h"
 
 #include <file/file_path.h>
 #include <libretro.h>
@@ -30,15 +41,17 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define CDIMAGE_SECTOR_SIZE 2048
+#define CDROM_SECTORS_PER_SECOND_2X 150
 
 static cdimage_t            CDIMAGE;
-static uint32_t             CDIMAGE_SECTOR;
 static uint32_t            *g_VIDEO_BUFFER;
+static void                *g_VIDEO_FRAME;
+static uint32_t             g_VIDEO_FRAME_PITCH;
 static uint32_t             g_VIDEO_WIDTH;
 static uint32_t             g_VIDEO_HEIGHT;
 static uint32_t             g_VIDEO_PITCH_SHIFT;
 static uint32_t             ACTIVE_DEVICES;
+static bool                 g_LATE_INPUT_LATCH  = false;
 static int                  g_PIXEL_FORMAT_SET  = false;
 static vdlp_pixel_format_e  g_VDLP_PIXEL_FORMAT = VDLP_PIXEL_FORMAT_XRGB8888;
 static uint32_t             g_VDLP_FLAGS        = VDLP_FLAG_NONE;
@@ -128,47 +141,28 @@ retro_set_input_state(retro_input_state_t cb_)
 }
 
 static
-void
+int
 video_init(void)
 {
   uint32_t size;
 
   /* The 4x multiplication is for hires mode */
   size = (opera_region_max_width() * opera_region_max_height() * 4);
+  g_VIDEO_BUFFER = (uint32_t*)opera_arena_alloc(size * sizeof(uint32_t));
   if(g_VIDEO_BUFFER == NULL)
-    g_VIDEO_BUFFER = (uint32_t*)calloc(size,sizeof(uint32_t));
+    return -1;
+
+  return 0;
 }
 
 static
 void
 video_destroy(void)
 {
-  if(g_VIDEO_BUFFER != NULL)
-    free(g_VIDEO_BUFFER);
+  /* released with the libopera arena */
   g_VIDEO_BUFFER = NULL;
 }
 
-static
-uint32_t
-cdimage_get_size(void)
-{
-  return retro_cdimage_get_number_of_logical_blocks(&CDIMAGE);
-}
-
-static
-void
-cdimage_set_sector(const uint32_t sector_)
-{
-  CDIMAGE_SECTOR = sector_;
-}
-
-static
-void
-cdimage_read_sector(void *buf_)
-{
-  retro_cdimage_read(&CDIMAGE,CDIMAGE_SECTOR,buf_,CDIMAGE_SECTOR_SIZE);
-}
-
 static
 void*
 libopera_callback(int   cmd_,
@@ -186,6 +180,38 @@ libopera_callback(int   cmd_,
   return NULL;
 }
 
+/* libopera plus the video buffer, both out of the libopera arena */
+static
+int
+emulator_init(void)
+{
+  if(opera_3do_init(libopera_callback) == -1)
+    {
+      retro_log_printf_cb(RETRO_LOG_ERROR,
+                          "[Opera]: unable to allocate emulator memory\n");
+      video_destroy();
+      return -1;
+    }
+
+  if(video_init() == -1)
+    {
+      retro_log_printf_cb(RETRO_LOG_ERROR,
+                          "[Opera]: unable to allocate video buffer\n");
+      opera_3do_destroy();
+      return -1;
+    }
+
+  return 0;
+}
+
+/* false once a failed reset has left nothing to run */
+static
+bool
+emulator_running(void)
+{
+  return (g_VIDEO_BUFFER != NULL);
+}
+
 #ifndef GIT_VERSION
 #define GIT_VERSION ""
 #endif
@@ -210,7 +236,7 @@ bool
 retro_serialize(void   *data_,
                 size_t  size_)
 {
-  if(size_ != opera_3do_state_size())
+  if(!emulator_running() || (size_ != opera_3do_state_size()))
     return false;
 
   opera_3do_state_save(data_);
@@ -222,10 +248,12 @@ bool
 retro_unserialize(const void *data_,
                   size_t      size_)
 {
-  if(size_ != opera_3do_state_size())
+  if(!emulator_running() || (size_ != opera_3do_state_size()))
     return false;
 
   opera_3do_state_load(data_);
+  lr_rewind_reset();
+  lr_runahead_reset();
 
   return true;
 }
@@ -383,6 +411,8 @@ chkopt_high_resolution(void)
     }
   else
     {
+      if(HIRESMODE)
+        opera_hires_reset();
       HIRESMODE       = 0;
       g_VIDEO_WIDTH   = opera_region_width();
       g_VIDEO_HEIGHT  = opera_region_height();
@@ -473,6 +503,16 @@ chkopt_active_devices(void)
     ACTIVE_DEVICES = 1;
 }
 
+static
+void
+chkopt_input_latch(void)
+{
+  const char *val;
+
+  val = chkopt_getval("input_latch");
+  g_LATE_INPUT_LATCH = ((val != NULL) && !strcmp(val,"late"));
+}
+
 static
 void
 chkopt_madam_matrix_engine(void)
@@ -503,6 +543,26 @@ chkopt_kprint(void)
     opera_madam_kprint_disable();
 }
 
+static
+uint32_t
+chkopt_runahead_frames(void)
+{
+  const char *val;
+
+  val = chkopt_getval("runahead");
+  if((val == NULL) || !strcmp(val,"disabled"))
+    return 0;
+
+  return atoi(val);
+}
+
+static
+void
+chkopt_runahead(void)
+{
+  lr_runahead_init(chkopt_runahead_frames());
+}
+
 static
 void
 chkopt_dsp_threaded(void)
@@ -511,7 +571,88 @@ chkopt_dsp_threaded(void)
 
   rv = chkopt_is_enabled("dsp_threaded");
 
-  lr_dsp_init(rv);
+  /* run ahead rolls the DSP back so it must not run concurrently */
+  lr_dsp_init(rv && !chkopt_runahead_frames());
+}
+
+static
+void
+chkopt_cdrom_read_mode(void)
+{
+  const char *val;
+
+  val = chkopt_getval("cdrom_read_mode");
+  if((val == NULL) || !strcmp(val,"instant"))
+    {
+      lr_cdrom_set_threaded(false);
+      opera_cdrom_set_read_delay(0);
+    }
+  else if(!strcmp(val,"fast"))
+    {
+      lr_cdrom_set_threaded(true);
+      opera_cdrom_set_read_delay(1);
+    }
+  else if(!strcmp(val,"2x"))
+    {
+      lr_cdrom_set_threaded(true);
+      opera_cdrom_set_read_delay(opera_clock_cpu_get_freq() /
+                                 CDROM_SECTORS_PER_SECOND_2X);
+    }
+}
+
+static
+void
+chkopt_rewind(void)
+{
+  bool rv;
+  int enabled;
+  const char *val;
+
+  enabled = lr_rewind_enabled();
+
+  rv = chkopt_is_enabled("rewind");
+  if(!rv)
+    {
+      lr_rewind_destroy();
+    }
+  else
+    {
+      val = chkopt_getval("rewind_buffer_size");
+      if(val == NULL)
+        val = "128";
+
+      lr_rewind_init((uint64_t)atoi(val) << 20);
+    }
+
+  /* the rewind button is listed with the port 1 descriptors */
+  if(enabled != lr_rewind_enabled())
+    lr_input_descs_update();
+}
+
+static
+void
+chkopt_frameskip(void)
+{
+  const char *val;
+  unsigned threshold;
+  lr_frameskip_mode_e mode;
+
+  mode = LR_FRAMESKIP_DISABLED;
+  val  = chkopt_getval("frameskip");
+  if(val != NULL)
+    {
+      if(!strcmp(val,"auto"))
+        mode = LR_FRAMESKIP_AUTO;
+      else if(!strcmp(val,"manual"))
+        mode = LR_FRAMESKIP_MANUAL;
+    }
+
+  threshold = 33;
+  val = chkopt_getval("frameskip_threshold");
+  if(val != NULL)
+    threshold = atoi(val);
+
+  lr_frameskip_set_mode(mode,threshold);
 }
 
 static
@@ -536,11 +677,16 @@ chkopts(void)
   chkopt_vdlp_bypass_clut();
   chkopt_high_resolution();
   chkopt_cpu_overclock();
+  chkopt_cdrom_read_mode();
   chkopt_dsp_threaded();
   chkopt_active_devices();
+  chkopt_input_latch();
   chkopt_kprint();
   chkopt_madam_matrix_engine();
   chkopt_swi_hle();
+  chkopt_rewind();
+  chkopt_frameskip();
+  chkopt_runahead();
   chkopt_set_reset_bits("hack_timing_1",&FIXMODE,FIX_BIT_TIMING_1);
   chkopt_set_reset_bits("hack_timing_3",&FIXMODE,FIX_BIT_TIMING_3);
   chkopt_set_reset_bits("hack_timing_5",&FIXMODE,FIX_BIT_TIMING_5);
@@ -708,16 +854,40 @@ print_cdimage_open_fail(const char *path_)
   return -1;
 }
 
+static
+const
+char*
+cdimage_index_dir(char   *buf_,
+                  size_t  bufsize_)
+{
+  int rv;
+  const char *system_path;
+
+  system_path = NULL;
+  rv = retro_environment_cb(RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY,&system_path);
+  if((rv == 0) || (system_path == NULL))
+    return NULL;
+
+  fill_pathname_join(buf_,system_path,"opera",bufsize_);
+  fill_pathname_join(buf_,buf_,"cache",bufsize_);
+
+  return buf_;
+}
+
 static
 int
 open_cdimage_if_needed(const struct retro_game_info *info_)
 {
   int rv;
+  const char *index_dir;
+  char index_dir_buf[PATH_MAX_LENGTH];
 
   if(info_ == NULL)
     return 0;
 
-  rv = retro_cdimage_open(info_->path,&CDIMAGE);
+  index_dir = cdimage_index_dir(index_dir_buf,sizeof(index_dir_buf));
+
+  rv = retro_cdimage_open_indexed(info_->path,index_dir,&CDIMAGE);
   if(rv == -1)
     return print_cdimage_open_fail(info_->path);
 
@@ -733,9 +903,12 @@ retro_load_game(const struct retro_game_info *info_)
   if(rv == -1)
     return false;
 
-  cdimage_set_sector(0);
-  opera_3do_init(libopera_callback);
-  video_init();
+  lr_cdrom_init(&CDIMAGE);
+  lr_cdrom_set_sector(0);
+  rv = emulator_init();
+  if(rv == -1)
+    return false;
+
   chkopts();
   load_rom1();
   load_rom2();
@@ -748,6 +921,9 @@ retro_load_game(const struct retro_game_info *info_)
   if(chkopt_nvram_shared())
     retro_nvram_load(opera_arm_nvram_get());
 
+  lr_prof_start(info_ ? info_->path : NULL);
+  lr_trace_start(info_ ? info_->path : NULL);
+
   return true;
 }
 
@@ -766,12 +942,19 @@ retro_load_game_special(unsigned                      game_type_,
 void
 retro_unload_game(void)
 {
-  if(chkopt_nvram_shared())
+  if(emulator_running() && chkopt_nvram_shared())
     retro_nvram_save(opera_arm_nvram_get());
 
+  lr_perf_log();
+  lr_trace_stop();
+  lr_prof_stop();
+  lr_rewind_destroy();
+  lr_runahead_destroy();
+  lr_frameskip_destroy();
   lr_dsp_destroy();
   opera_3do_destroy();
 
+  lr_cdrom_destroy();
   retro_cdimage_close(&CDIMAGE);
 
   video_destroy();
@@ -814,6 +997,9 @@ retro_api_version(void)
 void*
 retro_get_memory_data(unsigned id_)
 {
+  if(!emulator_running())
+    return NULL;
+
   switch(id_)
     {
     case RETRO_MEMORY_SAVE_RAM:
@@ -863,9 +1049,12 @@ retro_init(void)
   retro_environment_cb(RETRO_ENVIRONMENT_SET_PERFORMANCE_LEVEL,&level);
   retro_environment_cb(RETRO_ENVIRONMENT_SET_SERIALIZATION_QUIRKS,&serialization_quirks);
 
-  opera_cdrom_set_callbacks(cdimage_get_size,
-                            cdimage_set_sector,
-                            cdimage_read_sector);
+  opera_cdrom_set_callbacks(lr_cdrom_get_size,
+                            lr_cdrom_set_sector,
+                            lr_cdrom_read_sector);
+
+  lr_perf_init();
+  lr_frameskip_init();
 }
 
 void
@@ -877,18 +1066,21 @@ retro_deinit(void)
 void
 retro_reset(void)
 {
-  if(chkopt_nvram_shared())
+  if(emulator_running() && chkopt_nvram_shared())
     retro_nvram_save(opera_arm_nvram_get());
 
   lr_dsp_destroy();
   opera_3do_destroy();
 
-  opera_3do_init(libopera_callback);
-  video_init();
+  if(emulator_init() == -1)
+    return;
+
   chkopts();
-  cdimage_set_sector(0);
+  lr_cdrom_set_sector(0);
   load_rom1();
   load_rom2();
+  lr_rewind_reset();
+  lr_runahead_reset();
 
   /* XXX: Is this really a frontend responsibility? */
   nvram_init(opera_arm_nvram_get());
@@ -896,23 +1088,114 @@ retro_reset(void)
     retro_nvram_load(opera_arm_nvram_get());
 }
 
+/*
+  Renders straight into the frontend's framebuffer when it offers one
+  matching our format, saving the copy it would otherwise make of
+  g_VIDEO_BUFFER. Skipped frames aren't rendered so keep the internal
+  buffer.
+*/
+static
+void
+video_select_buffer(const int skip_)
+{
+  uint32_t bpp;
+  struct retro_framebuffer fb;
+
+  bpp                 = (1 << g_VIDEO_PITCH_SHIFT);
+  g_VIDEO_FRAME       = g_VIDEO_BUFFER;
+  g_VIDEO_FRAME_PITCH = (g_VIDEO_WIDTH << g_VIDEO_PITCH_SHIFT);
+
+  memset(&fb,0,sizeof(fb));
+  fb.width        = g_VIDEO_WIDTH;
+  fb.height       = g_VIDEO_HEIGHT;
+  fb.access_flags = RETRO_MEMORY_ACCESS_WRITE;
+  if(!skip_ &&
+     retro_environment_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER,&fb) &&
+     (fb.data != NULL) &&
+     (fb.format == vdlp_pixel_format_to_libretro(g_VDLP_PIXEL_FORMAT)) &&
+     (fb.width == g_VIDEO_WIDTH) &&
+     (fb.height == g_VIDEO_HEIGHT) &&
+     (fb.pitch >= g_VIDEO_FRAME_PITCH) &&
+     ((fb.pitch % bpp) == 0) &&
+     (((uintptr_t)fb.data % bpp) == 0))
+    {
+      g_VIDEO_FRAME       = fb.data;
+      g_VIDEO_FRAME_PITCH = fb.pitch;
+    }
+
+  opera_vdlp_set_buffer(g_VIDEO_FRAME,g_VIDEO_FRAME_PITCH);
+}
+
 void
 retro_run(void)
 {
+  int skip;
   bool updated = false;
+
+  if(!emulator_running())
+    return;
+
+  OPERA_TRACE_BEGIN("retro_run");
   if(retro_environment_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE,&updated) && updated)
     chkopts();
 
-  lr_input_update(ACTIVE_DEVICES);
+  OPERA_TRACE_BEGIN("input");
+  if(g_LATE_INPUT_LATCH)
+    lr_input_latch_defer(ACTIVE_DEVICES);
+  else
+    lr_input_update(ACTIVE_DEVICES);
+  OPERA_TRACE_END("input");
+
+  /*
+    A deferred latch hasn't polled yet. Poll for the rewind button so
+    it isn't read from last frame's state; the latch polls again.
+  */
+  OPERA_TRACE_BEGIN("rewind");
+  if(g_LATE_INPUT_LATCH && lr_rewind_enabled())
+    retro_input_poll_cb();
+  if(lr_rewind_enabled() &&
+     retro_input_state_cb(LR_REWIND_PORT,RETRO_DEVICE_JOYPAD,0,LR_REWIND_BUTTON))
+    lr_rewind_step();
+  else
+    lr_rewind_push();
+  OPERA_TRACE_END("rewind");
+
+  skip = lr_frameskip_check();
+  video_select_buffer(skip);
+  if(lr_runahead_enabled())
+    {
+      lr_runahead_run(skip);
+    }
+  else
+    {
+      opera_vdlp_set_skip(skip);
+      opera_3do_process_frame();
+    }
 
-  opera_3do_process_frame();
+  lr_input_latch_finish();
 
-  lr_input_crosshairs_draw(g_VIDEO_BUFFER,g_VIDEO_WIDTH,g_VIDEO_HEIGHT);
+  if(!skip)
+    lr_input_crosshairs_draw(g_VIDEO_FRAME,
+                             g_VIDEO_WIDTH,
+                             g_VIDEO_HEIGHT,
+                             g_VIDEO_FRAME_PITCH >> g_VIDEO_PITCH_SHIFT);
 
+  OPERA_TRACE_BEGIN("audio");
   lr_dsp_upload();
-
-  retro_video_refresh_cb(g_VIDEO_BUFFER,
+  OPERA_TRACE_END("audio");
+  lr_perf_update();
+
+  /*
+    A frontend that can't dupe only skips frames it discards anyway
+    so handing it the stale buffer is harmless.
+  */
+  OPERA_TRACE_BEGIN("video");
+  retro_video_refresh_cb(((skip && lr_frameskip_can_dupe()) ? NULL : g_VIDEO_FRAME),
                          g_VIDEO_WIDTH,
                          g_VIDEO_HEIGHT,
-                         g_VIDEO_WIDTH << g_VIDEO_PITCH_SHIFT);
+                         g_VIDEO_FRAME_PITCH);
+  OPERA_TRACE_END("video");
+  OPERA_TRACE_END("retro_run");
+
+  lr_trace_flush();
 }
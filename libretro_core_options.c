@@ -141,6 +141,105 @@ static struct retro_core_option_definition option_defs_us[] =
       "disabled"
     },
 #endif
+    {
+      "opera_cdrom_read_mode",
+      "CD-ROM Read Timing",
+      "'Instant' completes disc reads the moment they are requested (original behavior). 'Fast' delivers each block on the next emulated tick while a separate thread reads ahead on the host where supported. 'Accurate 2x' delays every block by the time a double speed drive takes to read it.",
+      {
+        { "instant", "Instant" },
+        { "fast",    "Fast" },
+        { "2x",      "Accurate 2x" },
+        { NULL, NULL },
+      },
+      "instant"
+    },
+    {
+      "opera_rewind",
+      "Rewind",
+      "Keeps a compressed history of recent frames inside the core. Hold L2 on controller port 1 (listed as 'Rewind (hold)' in the controls) to step backwards through it. Each frame only stores the memory pages the game wrote during that frame so long histories stay small.",
+      {
+        { "disabled", NULL },
+        { "enabled",  NULL },
+        { NULL, NULL },
+      },
+      "disabled"
+    },
+    {
+      "opera_rewind_buffer_size",
+      "Rewind Buffer Size",
+      "Memory budget for the rewind history. The oldest frames are discarded once it is exceeded.",
+      {
+        { "32",  "32MB" },
+        { "64",  "64MB" },
+        { "128", "128MB" },
+        { "256", "256MB" },
+        { "512", "512MB" },
+        { NULL, NULL },
+      },
+      "128"
+    },
+    {
+      "opera_frameskip",
+      "Frameskip",
+      "Skip converting frames to the output buffer to avoid audio crackling when the host can't keep up. 'Auto' skips when the frontend predicts an audio underrun. 'Manual' skips while the audio buffer is below the threshold. Frames the frontend discards (fast forward, run ahead) are always skipped. Requires a frontend that reports its audio buffer status.",
+      {
+        { "disabled", NULL },
+        { "auto",     "Auto" },
+        { "manual",   "Manual" },
+        { NULL, NULL },
+      },
+      "disabled"
+    },
+    {
+      "opera_frameskip_threshold",
+      "Frameskip Threshold (%)",
+      "Audio buffer occupancy below which frames are skipped when 'Frameskip' is 'Manual'.",
+      {
+        { "15", NULL },
+        { "18", NULL },
+        { "21", NULL },
+        { "24", NULL },
+        { "27", NULL },
+        { "30", NULL },
+        { "33", NULL },
+        { "36", NULL },
+        { "39", NULL },
+        { "42", NULL },
+        { "45", NULL },
+        { "48", NULL },
+        { "51", NULL },
+        { "54", NULL },
+        { "57", NULL },
+        { "60", NULL },
+        { NULL, NULL },
+      },
+      "33"
+    },
+    {
+      "opera_runahead",
+      "Run-Ahead",
+      "Reduces input latency by emulating this many frames ahead on the current input and showing the last one, then rolling back. Only the memory pages those frames wrote are restored so it is far cheaper than the frontend's run-ahead. Forces the DSP onto the main thread.",
+      {
+        { "disabled", NULL },
+        { "1", "1 frame" },
+        { "2", "2 frames" },
+        { "3", "3 frames" },
+        { "4", "4 frames" },
+        { NULL, NULL },
+      },
+      "disabled"
+    },
+    {
+      "opera_input_latch",
+      "Input Latching",
+      "'Frame Start' reads input once before each frame. 'Late' waits until the game fetches controller data over the PBUS, cutting up to a frame of input latency at no extra cost.",
+      {
+        { "early", "Frame Start" },
+        { "late",  "Late" },
+        { NULL, NULL },
+      },
+      "early"
+    },
     {
       "opera_nvram_storage",
       "NVRAM Storage",
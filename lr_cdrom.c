@@ -0,0 +1,216 @@
+#include "lr_cdrom.h"
+
+#include "libopera/bool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if THREADED_CDROM
+#include <pthread.h>
+#endif
+
+#define LR_CDROM_SECTOR_SIZE 2048
+
+static cdimage_t *g_cdimage = NULL;
+static uint32_t   g_sector  = 0;
+
+#if THREADED_CDROM
+
+/*
+  A single worker reads ahead the sector the emulated drive was last
+  pointed at (or the one after the last sector read) so host I/O
+  overlaps with emulation. The image stream is only ever touched by
+  one thread at a time: the main thread waits for the worker to go
+  idle before reading directly.
+*/
+
+enum prefetch_state_e
+  {
+    PREFETCH_IDLE,
+    PREFETCH_PENDING,
+    PREFETCH_DONE
+  };
+
+static bool_t          g_threaded = FALSE;
+static bool_t          g_quit     = FALSE;
+static pthread_t       g_thread;
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  g_cond  = PTHREAD_COND_INITIALIZER;
+
+static int      g_prefetch_state  = PREFETCH_IDLE;
+static uint32_t g_prefetch_sector = 0;
+static uint8_t  g_prefetch_buf[LR_CDROM_SECTOR_SIZE];
+
+/*
+  The host read runs unlocked. While the state is PENDING the worker
+  owns the stream and g_prefetch_buf, everyone else waits for it to
+  leave PENDING before touching either.
+*/
+static
+void*
+cdrom_thread_loop(void *handle_)
+{
+  uint32_t sector;
+
+  pthread_mutex_lock(&g_mutex);
+  for(;;)
+    {
+      while(!g_quit && (g_prefetch_state != PREFETCH_PENDING))
+        pthread_cond_wait(&g_cond,&g_mutex);
+      if(g_quit)
+        break;
+
+      sector = g_prefetch_sector;
+      pthread_mutex_unlock(&g_mutex);
+
+      retro_cdimage_read(g_cdimage,
+                         sector,
+                         g_prefetch_buf,
+                         sizeof(g_prefetch_buf));
+
+      pthread_mutex_lock(&g_mutex);
+      g_prefetch_state = PREFETCH_DONE;
+      pthread_cond_broadcast(&g_cond);
+    }
+  pthread_mutex_unlock(&g_mutex);
+
+  return NULL;
+}
+
+/* must hold g_mutex */
+static
+void
+cdrom_wait_idle(void)
+{
+  while(g_prefetch_state == PREFETCH_PENDING)
+    pthread_cond_wait(&g_cond,&g_mutex);
+}
+
+/* must hold g_mutex */
+static
+void
+cdrom_prefetch(const uint32_t sector_)
+{
+  if((g_prefetch_state != PREFETCH_IDLE) && (g_prefetch_sector == sector_))
+    return;
+
+  cdrom_wait_idle();
+
+  g_prefetch_sector = sector_;
+  g_prefetch_state  = PREFETCH_PENDING;
+  pthread_cond_broadcast(&g_cond);
+}
+
+void
+lr_cdrom_set_threaded(const int threaded_)
+{
+  if((g_cdimage == NULL) || (g_cdimage->fp == NULL))
+    return;
+  if(g_threaded == !!threaded_)
+    return;
+
+  if(g_threaded)
+    {
+      pthread_mutex_lock(&g_mutex);
+      g_quit = TRUE;
+      pthread_cond_broadcast(&g_cond);
+      pthread_mutex_unlock(&g_mutex);
+
+      pthread_join(g_thread,NULL);
+    }
+
+  g_quit           = FALSE;
+  g_threaded       = !!threaded_;
+  g_prefetch_state = PREFETCH_IDLE;
+
+  if(g_threaded)
+    pthread_create(&g_thread,NULL,cdrom_thread_loop,NULL);
+}
+
+uint32_t
+lr_cdrom_get_size(void)
+{
+  uint32_t rv;
+
+  pthread_mutex_lock(&g_mutex);
+  cdrom_wait_idle();
+  rv = retro_cdimage_get_number_of_logical_blocks(g_cdimage);
+  pthread_mutex_unlock(&g_mutex);
+
+  return rv;
+}
+
+void
+lr_cdrom_set_sector(const uint32_t sector_)
+{
+  g_sector = sector_;
+
+  if(!g_threaded)
+    return;
+
+  pthread_mutex_lock(&g_mutex);
+  cdrom_prefetch(sector_);
+  pthread_mutex_unlock(&g_mutex);
+}
+
+void
+lr_cdrom_read_sector(void *buf_)
+{
+  pthread_mutex_lock(&g_mutex);
+
+  cdrom_wait_idle();
+  if((g_prefetch_state == PREFETCH_DONE) && (g_prefetch_sector == g_sector))
+    memcpy(buf_,g_prefetch_buf,LR_CDROM_SECTOR_SIZE);
+  else
+    retro_cdimage_read(g_cdimage,g_sector,buf_,LR_CDROM_SECTOR_SIZE);
+
+  if(g_threaded)
+    cdrom_prefetch(g_sector + 1);
+
+  pthread_mutex_unlock(&g_mutex);
+}
+
+#else
+
+void
+lr_cdrom_set_threaded(const int threaded_)
+{
+  (void)threaded_;
+}
+
+uint32_t
+lr_cdrom_get_size(void)
+{
+  return retro_cdimage_get_number_of_logical_blocks(g_cdimage);
+}
+
+void
+lr_cdrom_set_sector(const uint32_t sector_)
+{
+  g_sector = sector_;
+}
+
+void
+lr_cdrom_read_sector(void *buf_)
+{
+  retro_cdimage_read(g_cdimage,g_sector,buf_,LR_CDROM_SECTOR_SIZE);
+}
+
+#endif
+
+void
+lr_cdrom_init(cdimage_t *cdimage_)
+{
+  lr_cdrom_destroy();
+
+  g_cdimage = cdimage_;
+  g_sector  = 0;
+}
+
+void
+lr_cdrom_destroy(void)
+{
+  lr_cdrom_set_threaded(FALSE);
+
+  g_cdimage = NULL;
+}
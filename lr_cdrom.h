@@ -0,0 +1,17 @@
+#ifndef LIBRETRO_LR_CDROM_H_INCLUDED
+#define LIBRETRO_LR_CDROM_H_INCLUDED
+
+#include "retro_cdimage.h"
+
+#include <stdint.h>
+
+void     lr_cdrom_init(cdimage_t *cdimage_);
+void     lr_cdrom_destroy(void);
+
+void     lr_cdrom_set_threaded(const int threaded_);
+
+uint32_t lr_cdrom_get_size(void);
+void     lr_cdrom_set_sector(const uint32_t sector_);
+void     lr_cdrom_read_sector(void *buf_);
+
+#endif
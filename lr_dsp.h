@@ -1,10 +1,15 @@
 #ifndef LIBRETRO_LR_DSP_H_INCLUDED
 #define LIBRETRO_LR_DSP_H_INCLUDED
 
-void lr_dsp_init(const int threaded);
-void lr_dsp_destroy(void);
+#include <stdint.h>
 
-void lr_dsp_upload(void);
-void lr_dsp_process(void);
+void     lr_dsp_init(const int threaded);
+void     lr_dsp_destroy(void);
+
+void     lr_dsp_upload(void);
+void     lr_dsp_process(void);
+
+uint32_t lr_dsp_tell(void);
+void     lr_dsp_truncate(const uint32_t count);
 
 #endif
@@ -0,0 +1,154 @@
+#include "lr_frameskip.h"
+
+#include "retro_callbacks.h"
+
+#include "libopera/bool.h"
+#include "libopera/opera_region.h"
+
+#include <libretro.h>
+
+/*
+  Decides per retro_run whether the frame will be shown. Frames are
+  skipped when the frontend says it will discard video (fast forward
+  and run ahead's secondary frames) and, when enabled, while the
+  frontend's audio buffer is running low. Skipping needs a frontend
+  that can dupe the previous frame.
+*/
+
+/* newer than the bundled libretro.h */
+#ifndef RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK
+#define RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK 62
+typedef void (RETRO_CALLCONV *retro_audio_buffer_status_callback_t)(bool     active,
+                                                                    unsigned occupancy,
+                                                                    bool     underrun_likely);
+struct retro_audio_buffer_status_callback
+{
+  retro_audio_buffer_status_callback_t callback;
+};
+#endif
+
+#ifndef RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY
+#define RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY 63
+#endif
+
+#define FRAMESKIP_MAX_CONSECUTIVE 30
+#define FRAMESKIP_LATENCY_FRAMES  6
+
+static bool_t              g_CAN_DUPE        = FALSE;
+static lr_frameskip_mode_e g_MODE            = LR_FRAMESKIP_DISABLED;
+static unsigned            g_THRESHOLD       = 0;
+static bool_t              g_AUDIO_ACTIVE    = FALSE;
+static unsigned            g_AUDIO_OCCUPANCY = 0;
+static bool_t              g_UNDERRUN_LIKELY = FALSE;
+static unsigned            g_SKIPPED         = 0;
+
+static
+void
+RETRO_CALLCONV
+audio_buffer_status(bool     active_,
+                    unsigned occupancy_,
+                    bool     underrun_likely_)
+{
+  g_AUDIO_ACTIVE    = active_;
+  g_AUDIO_OCCUPANCY = occupancy_;
+  g_UNDERRUN_LIKELY = underrun_likely_;
+}
+
+void
+lr_frameskip_init(void)
+{
+  bool dupe;
+
+  dupe = false;
+  if(!retro_environment_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE,&dupe))
+    dupe = false;
+
+  g_CAN_DUPE = dupe;
+}
+
+void
+lr_frameskip_set_mode(const lr_frameskip_mode_e mode_,
+                      const unsigned            threshold_)
+{
+  unsigned latency;
+  struct retro_audio_buffer_status_callback cb;
+
+  g_THRESHOLD = threshold_;
+  if(mode_ == g_MODE)
+    return;
+
+  g_MODE         = mode_;
+  g_SKIPPED      = 0;
+  g_AUDIO_ACTIVE = FALSE;
+
+  if(g_MODE == LR_FRAMESKIP_DISABLED)
+    {
+      latency = 0;
+      retro_environment_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK,NULL);
+      retro_environment_cb(RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY,&latency);
+      return;
+    }
+
+  cb.callback = audio_buffer_status;
+  if(!retro_environment_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK,&cb))
+    {
+      retro_log_printf_cb(RETRO_LOG_WARN,
+                          "[Opera]: frontend does not report audio buffer status, frameskip disabled\n");
+      return;
+    }
+
+  /* a few frames of slack so a skip can refill the buffer */
+  latency = (unsigned)((FRAMESKIP_LATENCY_FRAMES * 1000.0) / opera_region_field_rate());
+  retro_environment_cb(RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY,&latency);
+}
+
+void
+lr_frameskip_destroy(void)
+{
+  lr_frameskip_set_mode(LR_FRAMESKIP_DISABLED,0);
+}
+
+int
+lr_frameskip_can_dupe(void)
+{
+  return g_CAN_DUPE;
+}
+
+int
+lr_frameskip_check(void)
+{
+  int av;
+  bool_t skip;
+
+  av = 3;
+  if(retro_environment_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE,&av) &&
+     !(av & 1))
+    return TRUE;
+
+  if(!g_CAN_DUPE || !g_AUDIO_ACTIVE)
+    return FALSE;
+
+  switch(g_MODE)
+    {
+    case LR_FRAMESKIP_AUTO:
+      skip = g_UNDERRUN_LIKELY;
+      break;
+    case LR_FRAMESKIP_MANUAL:
+      skip = (g_AUDIO_OCCUPANCY < g_THRESHOLD);
+      break;
+    default:
+      skip = FALSE;
+      break;
+    }
+
+  /* always show something now and then */
+  if(skip && (g_SKIPPED < FRAMESKIP_MAX_CONSECUTIVE))
+    {
+      g_SKIPPED++;
+      return TRUE;
+    }
+
+  g_SKIPPED = 0;
+
+  return FALSE;
+}
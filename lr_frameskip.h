@@ -0,0 +1,21 @@
+#ifndef LIBRETRO_LR_FRAMESKIP_H_INCLUDED
+#define LIBRETRO_LR_FRAMESKIP_H_INCLUDED
+
+enum lr_frameskip_mode_e
+  {
+    LR_FRAMESKIP_DISABLED,
+    LR_FRAMESKIP_AUTO,
+    LR_FRAMESKIP_MANUAL
+  };
+
+typedef enum lr_frameskip_mode_e lr_frameskip_mode_e;
+
+void lr_frameskip_init(void);
+void lr_frameskip_set_mode(const lr_frameskip_mode_e mode_,
+                           const unsigned            threshold_);
+void lr_frameskip_destroy(void);
+
+int  lr_frameskip_can_dupe(void);
+int  lr_frameskip_check(void);
+
+#endif
@@ -8,6 +8,8 @@
 #include <libretro.h>
 
 static uint32_t ACTIVE_DEVICES = 0;
+static uint32_t LATCH_DEVICES  = 0;
+static int      LATCH_PENDING  = 0;
 static unsigned PBUS_DEVICES[LR_INPUT_MAX_DEVICES] = {0};
 
 static
@@ -264,3 +266,34 @@ lr_input_update(const uint32_t active_devices_)
       lr_input_poll(i);
     }
 }
+
+static
+void
+lr_input_latch(void)
+{
+  LATCH_PENDING = 0;
+  lr_input_update(LATCH_DEVICES);
+}
+
+/*
+  Defers polling until the guest DMAs the PBUS buffer. If it doesn't
+  this frame lr_input_latch_finish() polls so the frontend still sees
+  one poll per frame.
+*/
+void
+lr_input_latch_defer(const uint32_t active_devices_)
+{
+  LATCH_DEVICES = active_devices_;
+  LATCH_PENDING = 1;
+  opera_pbus_set_latch_cb(lr_input_latch);
+}
+
+void
+lr_input_latch_finish(void)
+{
+  if(!LATCH_PENDING)
+    return;
+
+  opera_pbus_set_latch_cb(NULL);
+  lr_input_latch();
+}
@@ -15,4 +15,7 @@ uint32_t lr_input_device_get(const uint32_t port_);
 
 void     lr_input_update(const uint32_t active_devices_);
 
+void     lr_input_latch_defer(const uint32_t active_devices_);
+void     lr_input_latch_finish(void);
+
 #endif
@@ -30,7 +30,8 @@ void
 lr_input_crosshair_draw(const lr_crosshair_t *crosshair_,
                         uint32_t             *buf_,
                         const int32_t         width_,
-                        const int32_t         height_)
+                        const int32_t         height_,
+                        const int32_t         stride_)
 {
   int32_t x;
   int32_t y;
@@ -39,7 +40,7 @@ lr_input_crosshair_draw(const lr_crosshair_t *crosshair_,
   x = ((crosshair_->x + 32768) / (65535 / width_));
   y = ((crosshair_->y + 32768) / (65535 / height_));
 
-  p = &buf_[x + (y * width_)];
+  p = &buf_[x + (y * stride_)];
 
   *p = crosshair_->c;
   if(x >= 1)
@@ -47,9 +48,9 @@ lr_input_crosshair_draw(const lr_crosshair_t *crosshair_,
   if(x < (width_ - 1))
     *(p + 1) = crosshair_->c;
   if(y >= 1)
-    *(p - width_) = crosshair_->c;
+    *(p - stride_) = crosshair_->c;
   if(y < (height_ - 1))
-    *(p + width_) = crosshair_->c;
+    *(p + stride_) = crosshair_->c;
 }
 
 void
@@ -79,7 +80,8 @@ lr_input_crosshair_reset(const uint32_t i_)
 void
 lr_input_crosshairs_draw(uint32_t       *buf_,
                          const uint32_t  width_,
-                         const uint32_t  height_)
+                         const uint32_t  height_,
+                         const uint32_t  stride_)
 {
   int i;
 
@@ -88,6 +90,6 @@ lr_input_crosshairs_draw(uint32_t       *buf_,
       if(CROSSHAIRS[i].c == 0)
         continue;
 
-      lr_input_crosshair_draw(&CROSSHAIRS[i],buf_,width_,height_);
+      lr_input_crosshair_draw(&CROSSHAIRS[i],buf_,width_,height_,stride_);
     }
 }
@@ -9,6 +9,7 @@ void lr_input_crosshair_set(const uint32_t i_,
                             const int32_t  y_);
 void lr_input_crosshairs_draw(uint32_t       *buf_,
                               const uint32_t  width_,
-                              const uint32_t  height_);
+                              const uint32_t  height_,
+                              const uint32_t  stride_);
 
 #endif
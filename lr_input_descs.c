@@ -1,6 +1,7 @@
 #include "lr_input.h"
 #include "retro_callbacks.h"
 #include "lr_input_crosshair.h"
+#include "lr_rewind.h"
 
 #include <libretro.h>
 
@@ -211,17 +212,13 @@ setup_orbatak_descs(struct retro_input_descriptor *desc_,
 }
 
 void
-lr_input_device_set_with_descs(const uint32_t port_,
-                               const uint32_t device_)
+lr_input_descs_update(void)
 {
   uint32_t i;
   uint32_t rv;
   struct retro_input_descriptor desc[256];
 
-  lr_input_device_set(port_,device_);
-
   rv = 0;
-  lr_input_crosshair_reset(port_);
   for(i = 0; i < LR_INPUT_MAX_DEVICES; i++)
     {
       switch(lr_input_device_get(i))
@@ -250,7 +247,19 @@ lr_input_device_set_with_descs(const uint32_t port_,
         }
     }
 
+  if(lr_rewind_enabled())
+    rv += setup_joypad_desc(&desc[rv],LR_REWIND_PORT,LR_REWIND_BUTTON,"Rewind (hold)");
+
   memset(&desc[rv],0,sizeof(struct retro_input_descriptor));
 
   retro_environment_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS,desc);
 }
+
+void
+lr_input_device_set_with_descs(const uint32_t port_,
+                               const uint32_t device_)
+{
+  lr_input_device_set(port_,device_);
+  lr_input_crosshair_reset(port_);
+  lr_input_descs_update();
+}
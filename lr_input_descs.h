@@ -1,6 +1,7 @@
 #ifndef LIBRETRO_LR_INPUT_DESCS_H_INCLUDED
 #define LIBRETRO_LR_INPUT_DESCS_H_INCLUDED
 
+void lr_input_descs_update(void);
 void lr_input_device_set_with_descs(const uint32_t port_,
                                     const uint32_t device_);
 
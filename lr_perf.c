@@ -0,0 +1,86 @@
+#include "lr_perf.h"
+
+#ifdef OPERA_PERF
+
+#include "libopera/opera_perf.h"
+
+#include "retro_callbacks.h"
+
+#include <libretro.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+/*
+  libopera's timers are mirrored into frontend perf counters after
+  every frame so they show up in the frontend's own perf log. The
+  event counters have no frontend equivalent and are logged directly.
+*/
+
+static bool                       g_PERF_AVAILABLE = false;
+static struct retro_perf_callback g_PERF_CB;
+static struct retro_perf_counter  g_PERF_COUNTERS[OPERA_PERF_TIMER_COUNT];
+
+void
+lr_perf_init(void)
+{
+  int i;
+
+  memset(&g_PERF_CB,0,sizeof(g_PERF_CB));
+  memset(g_PERF_COUNTERS,0,sizeof(g_PERF_COUNTERS));
+
+  g_PERF_AVAILABLE = retro_environment_cb(RETRO_ENVIRONMENT_GET_PERF_INTERFACE,&g_PERF_CB);
+  if(!g_PERF_AVAILABLE || (g_PERF_CB.get_perf_counter == NULL))
+    {
+      g_PERF_AVAILABLE = false;
+      return;
+    }
+
+  opera_perf_set_clock(g_PERF_CB.get_perf_counter);
+  opera_perf_reset();
+
+  if(g_PERF_CB.perf_register == NULL)
+    return;
+
+  for(i = 0; i < OPERA_PERF_TIMER_COUNT; i++)
+    {
+      g_PERF_COUNTERS[i].ident = opera_perf_timer_name(i);
+      g_PERF_CB.perf_register(&g_PERF_COUNTERS[i]);
+    }
+}
+
+void
+lr_perf_update(void)
+{
+  int i;
+
+  if(!g_PERF_AVAILABLE)
+    return;
+
+  for(i = 0; i < OPERA_PERF_TIMER_COUNT; i++)
+    {
+      g_PERF_COUNTERS[i].total    = opera_perf_time(i);
+      g_PERF_COUNTERS[i].call_cnt = opera_perf_calls(i);
+    }
+}
+
+void
+lr_perf_log(void)
+{
+  int i;
+
+  if(!g_PERF_AVAILABLE)
+    return;
+
+  lr_perf_update();
+  if(g_PERF_CB.perf_log != NULL)
+    g_PERF_CB.perf_log();
+
+  for(i = 0; i < OPERA_PERF_COUNTER_COUNT; i++)
+    retro_log_printf_cb(RETRO_LOG_INFO,
+                        "[Opera]: perf %s: %llu\n",
+                        opera_perf_counter_name(i),
+                        (unsigned long long)opera_perf_counter(i));
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef LIBRETRO_LR_PERF_H_INCLUDED
+#define LIBRETRO_LR_PERF_H_INCLUDED
+
+#include "libopera/inline.h"
+
+#ifdef OPERA_PERF
+
+void lr_perf_init(void);
+void lr_perf_update(void);
+void lr_perf_log(void);
+
+#else
+
+static INLINE void lr_perf_init(void) {}
+static INLINE void lr_perf_update(void) {}
+static INLINE void lr_perf_log(void) {}
+
+#endif
+
+#endif
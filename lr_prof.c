@@ -0,0 +1,123 @@
+#include "lr_prof.h"
+
+#ifdef OPERA_PROF
+
+#include "libopera/opera_prof.h"
+
+#include "retro_callbacks.h"
+
+#include <compat/strl.h>
+#include <file/file_path.h>
+#include <libretro.h>
+#include <retro_miscellaneous.h>
+#include <streams/file_stream.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+  Symbols are read from <system>/opera/symbols.txt when present and
+  reports are written to <system>/opera/profile/<content>.flat.txt and
+  <content>.folded.txt when the game is unloaded.
+*/
+
+#define PROF_SYMBOLS_FILENAME "symbols.txt"
+
+static char g_PROF_NAME[PATH_MAX_LENGTH] = {0};
+
+static
+const char*
+prof_dir(char       *buf_,
+         size_t      bufsize_,
+         const char *subdir_)
+{
+  int rv;
+  const char *system_path;
+
+  system_path = NULL;
+  rv = retro_environment_cb(RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY,&system_path);
+  if((rv == 0) || (system_path == NULL))
+    return NULL;
+
+  fill_pathname_join(buf_,system_path,"opera",bufsize_);
+  if(subdir_ != NULL)
+    fill_pathname_join(buf_,buf_,subdir_,bufsize_);
+
+  return buf_;
+}
+
+static
+void
+prof_load_symbols(void)
+{
+  int64_t len;
+  void *buf;
+  char path[PATH_MAX_LENGTH];
+
+  if(prof_dir(path,sizeof(path),NULL) == NULL)
+    return;
+
+  fill_pathname_join(path,path,PROF_SYMBOLS_FILENAME,sizeof(path));
+  if(!path_is_valid(path))
+    return;
+
+  buf = NULL;
+  if(filestream_read_file(path,&buf,&len) <= 0)
+    return;
+
+  retro_log_printf_cb(RETRO_LOG_INFO,
+                      "[Opera]: profiler loaded %d symbols from %s\n",
+                      opera_prof_symbols_parse(buf),
+                      path);
+
+  free(buf);
+}
+
+static
+void
+prof_write(const char *dir_,
+           const char *suffix_,
+           char       *report_)
+{
+  char path[PATH_MAX_LENGTH];
+
+  if(report_ == NULL)
+    return;
+
+  fill_pathname_join(path,dir_,g_PROF_NAME,sizeof(path));
+  strlcat(path,suffix_,sizeof(path));
+
+  if(filestream_write_file(path,report_,strlen(report_)))
+    retro_log_printf_cb(RETRO_LOG_INFO,"[Opera]: profile written to %s\n",path);
+
+  free(report_);
+}
+
+void
+lr_prof_start(const char *content_path_)
+{
+  if(content_path_ != NULL)
+    fill_pathname_base_noext(g_PROF_NAME,content_path_,sizeof(g_PROF_NAME));
+  else
+    strlcpy(g_PROF_NAME,"bios",sizeof(g_PROF_NAME));
+
+  prof_load_symbols();
+  opera_prof_enable(OPERA_PROF_DEFAULT_INTERVAL);
+}
+
+void
+lr_prof_stop(void)
+{
+  char dir[PATH_MAX_LENGTH];
+
+  if(prof_dir(dir,sizeof(dir),"profile") != NULL)
+    {
+      path_mkdir(dir);
+      prof_write(dir,".flat.txt",opera_prof_report_flat());
+      prof_write(dir,".folded.txt",opera_prof_report_folded());
+    }
+
+  opera_prof_disable();
+}
+
+#endif
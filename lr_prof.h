@@ -0,0 +1,18 @@
+#ifndef LIBRETRO_LR_PROF_H_INCLUDED
+#define LIBRETRO_LR_PROF_H_INCLUDED
+
+#include "libopera/inline.h"
+
+#ifdef OPERA_PROF
+
+void lr_prof_start(const char *content_path_);
+void lr_prof_stop(void);
+
+#else
+
+static INLINE void lr_prof_start(const char *content_path_) {}
+static INLINE void lr_prof_stop(void) {}
+
+#endif
+
+#endif
@@ -0,0 +1,411 @@
+#include "lr_rewind.h"
+
+#include "libopera/bool.h"
+#include "libopera/opera_delta.h"
+
+#include <zlib.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if THREADED_REWIND
+#include <pthread.h>
+#endif
+
+/*
+  Core side rewind. Every frame an opera_delta step record (chip state
+  plus the XOR of the pages written during the previous frame) is
+  compressed and appended to a ring bounded by a byte budget. Stepping
+  back decompresses and undoes the newest entry. Entries only depend
+  on the ones after them so the oldest can be dropped on their own.
+  Compression runs on a worker thread where available.
+*/
+
+#define REWIND_MAX_ENTRIES  8192
+#define REWIND_RAW_BUFFERS  2
+#define REWIND_ZLIB_LEVEL   1
+
+struct rewind_entry_s
+{
+  uint8_t  *data;
+  uint32_t  size;
+  uint32_t  raw_size;
+};
+
+typedef struct rewind_entry_s rewind_entry_t;
+
+struct rewind_raw_s
+{
+  uint8_t  *data;
+  uint32_t  size;
+  bool_t    busy;
+};
+
+typedef struct rewind_raw_s rewind_raw_t;
+
+static opera_delta_t  *g_delta = NULL;
+static uint64_t        g_budget;
+static uint64_t        g_used;
+static rewind_entry_t  g_entries[REWIND_MAX_ENTRIES];
+static uint32_t        g_head;
+static uint32_t        g_count;
+static rewind_raw_t    g_raw[REWIND_RAW_BUFFERS];
+static uint8_t        *g_scratch;
+static uint32_t        g_raw_size;
+
+#if THREADED_REWIND
+static pthread_t       g_thread;
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  g_cond  = PTHREAD_COND_INITIALIZER;
+static bool_t          g_quit;
+static uint32_t        g_raw_fill;
+static uint32_t        g_raw_drain;
+#endif
+
+static
+void
+ring_lock(void)
+{
+#if THREADED_REWIND
+  pthread_mutex_lock(&g_mutex);
+#endif
+}
+
+static
+void
+ring_unlock(void)
+{
+#if THREADED_REWIND
+  pthread_mutex_unlock(&g_mutex);
+#endif
+}
+
+static
+rewind_entry_t*
+entry_at(const uint32_t i_)
+{
+  return &g_entries[(g_head + i_) % REWIND_MAX_ENTRIES];
+}
+
+static
+void
+entry_free(rewind_entry_t *e_)
+{
+  g_used -= e_->size;
+  free(e_->data);
+  memset(e_,0,sizeof(*e_));
+}
+
+static
+void
+ring_drop_oldest(void)
+{
+  entry_free(entry_at(0));
+  g_head = ((g_head + 1) % REWIND_MAX_ENTRIES);
+  g_count--;
+}
+
+static
+void
+ring_clear(void)
+{
+  while(g_count)
+    {
+      entry_free(entry_at(g_count - 1));
+      g_count--;
+    }
+
+  g_head = 0;
+  g_used = 0;
+}
+
+static
+void
+ring_push(rewind_entry_t *e_)
+{
+  while(g_count && ((g_count == REWIND_MAX_ENTRIES) ||
+                    ((g_used + e_->size) > g_budget)))
+    ring_drop_oldest();
+
+  *entry_at(g_count) = *e_;
+  g_count++;
+  g_used += e_->size;
+}
+
+/* a lost entry breaks the chain, everything older becomes unreachable */
+static
+void
+compress_raw(rewind_raw_t *raw_)
+{
+  int rv;
+  uLongf size;
+  rewind_entry_t e;
+
+  size = compressBound(raw_->size);
+  e.data = malloc(size);
+  if(e.data != NULL)
+    {
+      rv = compress2(e.data,&size,raw_->data,raw_->size,REWIND_ZLIB_LEVEL);
+      if(rv != Z_OK)
+        {
+          free(e.data);
+          e.data = NULL;
+        }
+    }
+
+  ring_lock();
+  if(e.data == NULL)
+    {
+      ring_clear();
+    }
+  else
+    {
+      e.data     = realloc(e.data,size);
+      e.size     = size;
+      e.raw_size = raw_->size;
+      ring_push(&e);
+    }
+  ring_unlock();
+}
+
+#if THREADED_REWIND
+
+/* raw buffers are filled and drained round robin to keep frame order */
+static
+void*
+rewind_thread_loop(void *handle_)
+{
+  rewind_raw_t *raw;
+
+  pthread_mutex_lock(&g_mutex);
+  for(;;)
+    {
+      raw = &g_raw[g_raw_drain % REWIND_RAW_BUFFERS];
+      if(!raw->busy)
+        {
+          if(g_quit)
+            break;
+          pthread_cond_wait(&g_cond,&g_mutex);
+          continue;
+        }
+
+      pthread_mutex_unlock(&g_mutex);
+      compress_raw(raw);
+      pthread_mutex_lock(&g_mutex);
+
+      raw->busy = FALSE;
+      g_raw_drain++;
+      pthread_cond_broadcast(&g_cond);
+    }
+  pthread_mutex_unlock(&g_mutex);
+
+  return NULL;
+}
+
+static
+rewind_raw_t*
+raw_acquire(void)
+{
+  rewind_raw_t *raw;
+
+  pthread_mutex_lock(&g_mutex);
+  raw = &g_raw[g_raw_fill % REWIND_RAW_BUFFERS];
+  while(raw->busy)
+    pthread_cond_wait(&g_cond,&g_mutex);
+  pthread_mutex_unlock(&g_mutex);
+
+  return raw;
+}
+
+static
+void
+raw_submit(rewind_raw_t *raw_)
+{
+  pthread_mutex_lock(&g_mutex);
+  raw_->busy = TRUE;
+  g_raw_fill++;
+  pthread_cond_broadcast(&g_cond);
+  pthread_mutex_unlock(&g_mutex);
+}
+
+static
+void
+raw_wait_all(void)
+{
+  int i;
+
+  pthread_mutex_lock(&g_mutex);
+  for(i = 0; i < REWIND_RAW_BUFFERS; i++)
+    while(g_raw[i].busy)
+      pthread_cond_wait(&g_cond,&g_mutex);
+  pthread_mutex_unlock(&g_mutex);
+}
+
+static
+void
+worker_start(void)
+{
+  g_quit      = FALSE;
+  g_raw_fill  = 0;
+  g_raw_drain = 0;
+  pthread_create(&g_thread,NULL,rewind_thread_loop,NULL);
+}
+
+static
+void
+worker_stop(void)
+{
+  pthread_mutex_lock(&g_mutex);
+  g_quit = TRUE;
+  pthread_cond_broadcast(&g_cond);
+  pthread_mutex_unlock(&g_mutex);
+
+  pthread_join(g_thread,NULL);
+}
+
+#else
+
+static
+rewind_raw_t*
+raw_acquire(void)
+{
+  return &g_raw[0];
+}
+
+static
+void
+raw_submit(rewind_raw_t *raw_)
+{
+  compress_raw(raw_);
+}
+
+static void raw_wait_all(void) {}
+static void worker_start(void) {}
+static void worker_stop(void) {}
+
+#endif
+
+static
+int
+entry_load(const rewind_entry_t *e_)
+{
+  int rv;
+  uLongf size;
+
+  size = g_raw_size;
+  rv = uncompress(g_scratch,&size,e_->data,e_->size);
+  if((rv != Z_OK) || (size != e_->raw_size))
+    return -1;
+
+  return opera_delta_load_step(g_delta,g_scratch);
+}
+
+int
+lr_rewind_enabled(void)
+{
+  return (g_delta != NULL);
+}
+
+void
+lr_rewind_destroy(void)
+{
+  int i;
+
+  if(g_delta == NULL)
+    return;
+
+  worker_stop();
+  ring_clear();
+
+  for(i = 0; i < REWIND_RAW_BUFFERS; i++)
+    {
+      free(g_raw[i].data);
+      g_raw[i].data = NULL;
+      g_raw[i].busy = FALSE;
+    }
+
+  free(g_scratch);
+  g_scratch = NULL;
+
+  opera_delta_free(g_delta);
+  g_delta = NULL;
+}
+
+void
+lr_rewind_init(const uint64_t budget_)
+{
+  int i;
+
+  if(g_delta != NULL)
+    {
+      g_budget = budget_;
+      return;
+    }
+
+  g_delta = opera_delta_new();
+  if(g_delta == NULL)
+    return;
+
+  g_budget   = budget_;
+  g_raw_size = opera_delta_max_size();
+  g_scratch  = malloc(g_raw_size);
+  for(i = 0; i < REWIND_RAW_BUFFERS; i++)
+    g_raw[i].data = malloc(g_raw_size);
+
+  worker_start();
+}
+
+/* history is meaningless across a reset or a full state load */
+void
+lr_rewind_reset(void)
+{
+  if(g_delta == NULL)
+    return;
+
+  raw_wait_all();
+  ring_clear();
+  opera_delta_force_keyframe(g_delta);
+}
+
+void
+lr_rewind_push(void)
+{
+  rewind_raw_t *raw;
+
+  if(g_delta == NULL)
+    return;
+
+  raw = raw_acquire();
+  raw->size = opera_delta_save_step(g_delta,raw->data);
+  raw_submit(raw);
+}
+
+/*
+  Restores the newest entry and removes it from the ring. Returns 0 on
+  success and -1 once history is exhausted.
+*/
+int
+lr_rewind_step(void)
+{
+  int rv;
+
+  if(g_delta == NULL)
+    return -1;
+
+  raw_wait_all();
+  if(g_count == 0)
+    return -1;
+
+  rv = entry_load(entry_at(g_count - 1));
+  if(rv == -1)
+    {
+      ring_clear();
+      return -1;
+    }
+
+  entry_free(entry_at(g_count - 1));
+  g_count--;
+
+  return 0;
+}
@@ -0,0 +1,20 @@
+#ifndef LIBRETRO_LR_REWIND_H_INCLUDED
+#define LIBRETRO_LR_REWIND_H_INCLUDED
+
+#include <libretro.h>
+
+#include <stdint.h>
+
+/* held to step backwards, libretro has no rewind hook a core can drive */
+#define LR_REWIND_PORT   0
+#define LR_REWIND_BUTTON RETRO_DEVICE_ID_JOYPAD_L2
+
+void lr_rewind_init(const uint64_t budget_);
+void lr_rewind_destroy(void);
+int  lr_rewind_enabled(void);
+
+void lr_rewind_reset(void);
+void lr_rewind_push(void);
+int  lr_rewind_step(void);
+
+#endif
@@ -0,0 +1,93 @@
+#include "lr_runahead.h"
+
+#include "lr_dsp.h"
+#include "retro_callbacks.h"
+
+#include "libopera/bool.h"
+#include "libopera/opera_3do.h"
+#include "libopera/opera_delta.h"
+#include "libopera/opera_vdlp.h"
+
+#include <stdint.h>
+
+/*
+  Core side run ahead. The real frame runs with its video hidden and
+  its audio kept, the state is checkpointed, then the hidden frames
+  run on the same input with their audio dropped and only the last
+  one converted for display. Rolling back only restores the chip
+  state and the pages the hidden frames wrote (see opera_delta).
+*/
+
+#define RUNAHEAD_MAX_FRAMES 4
+
+static opera_delta_t *g_delta  = NULL;
+static uint32_t       g_frames = 0;
+
+void
+lr_runahead_init(const uint32_t frames_)
+{
+  if(frames_ == 0)
+    {
+      lr_runahead_destroy();
+      return;
+    }
+
+  g_frames = ((frames_ > RUNAHEAD_MAX_FRAMES) ? RUNAHEAD_MAX_FRAMES : frames_);
+  if(g_delta != NULL)
+    return;
+
+  g_delta = opera_delta_new();
+  if(g_delta == NULL)
+    retro_log_printf_cb(RETRO_LOG_WARN,
+                        "[Opera]: unable to allocate run ahead state\n");
+}
+
+void
+lr_runahead_destroy(void)
+{
+  opera_delta_free(g_delta);
+  g_delta  = NULL;
+  g_frames = 0;
+}
+
+int
+lr_runahead_enabled(void)
+{
+  return (g_delta != NULL);
+}
+
+/* the checkpoint is only valid while nothing else rewrites memory */
+void
+lr_runahead_reset(void)
+{
+  if(g_delta != NULL)
+    opera_delta_force_keyframe(g_delta);
+}
+
+void
+lr_runahead_run(const int skip_video_)
+{
+  uint32_t i;
+  uint32_t samples;
+
+  opera_vdlp_set_skip(TRUE);
+  opera_3do_process_frame();
+
+  if(opera_delta_checkpoint(g_delta) == -1)
+    {
+      retro_log_printf_cb(RETRO_LOG_WARN,
+                          "[Opera]: run ahead checkpoint failed, disabling\n");
+      lr_runahead_destroy();
+      return;
+    }
+
+  samples = lr_dsp_tell();
+  for(i = 1; i <= g_frames; i++)
+    {
+      opera_vdlp_set_skip(skip_video_ || (i < g_frames));
+      opera_3do_process_frame();
+      lr_dsp_truncate(samples);
+    }
+
+  opera_delta_rollback(g_delta);
+}
@@ -0,0 +1,13 @@
+#ifndef LIBRETRO_LR_RUNAHEAD_H_INCLUDED
+#define LIBRETRO_LR_RUNAHEAD_H_INCLUDED
+
+#include <stdint.h>
+
+void lr_runahead_init(const uint32_t frames_);
+void lr_runahead_destroy(void);
+int  lr_runahead_enabled(void);
+void lr_runahead_reset(void);
+
+void lr_runahead_run(const int skip_video_);
+
+#endif
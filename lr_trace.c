@@ -0,0 +1,223 @@
+#include "lr_trace.h"
+
+#ifdef OPERA_TRACE
+
+#include "libopera/bool.h"
+#include "libopera/opera_trace.h"
+
+#include "retro_callbacks.h"
+
+#include <compat/strl.h>
+#include <file/file_path.h>
+#include <libretro.h>
+#include <retro_miscellaneous.h>
+#include <retro_timers.h>
+#include <streams/file_stream.h>
+
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#if THREADED_TRACE
+#include <pthread.h>
+#endif
+
+/*
+  Writes <system>/opera/trace/<content>.json while the game runs. The
+  emulator only appends to its in memory ring, the JSON is produced
+  and written out by a writer thread where available and otherwise at
+  the end of every retro_run. Open the file in chrome://tracing or
+  ui.perfetto.dev.
+*/
+
+#define TRACE_FLUSH_MS 20
+#define TRACE_BUF_SIZE (64 * 1024)
+
+struct trace_out_s
+{
+  RFILE    *file;
+  uint32_t  len;
+  char      buf[TRACE_BUF_SIZE];
+};
+
+typedef struct trace_out_s trace_out_t;
+
+static trace_out_t g_OUT;
+
+#if THREADED_TRACE
+static pthread_t       g_thread;
+static bool_t          g_thread_running = FALSE;
+static volatile bool_t g_quit;
+#endif
+
+static
+uint64_t
+trace_clock(void)
+{
+#if defined(_WIN32)
+  LARGE_INTEGER freq;
+  LARGE_INTEGER count;
+
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&count);
+
+  return (uint64_t)(((double)count.QuadPart * 1000000000.0) / (double)freq.QuadPart);
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+
+  return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+static
+void
+trace_out_flush(trace_out_t *out_)
+{
+  if(out_->len == 0)
+    return;
+
+  filestream_write(out_->file,out_->buf,out_->len);
+  out_->len = 0;
+}
+
+static
+void
+trace_out_write(void       *ctx_,
+                const char *str_,
+                size_t      len_)
+{
+  trace_out_t *out = ctx_;
+
+  if((out->len + len_) > sizeof(out->buf))
+    trace_out_flush(out);
+
+  memcpy(&out->buf[out->len],str_,len_);
+  out->len += len_;
+}
+
+static
+void
+trace_drain(void)
+{
+  opera_trace_drain(trace_out_write,&g_OUT);
+  trace_out_flush(&g_OUT);
+}
+
+#if THREADED_TRACE
+static
+void*
+trace_thread_loop(void *handle_)
+{
+  while(!g_quit)
+    {
+      trace_drain();
+      retro_sleep(TRACE_FLUSH_MS);
+    }
+
+  return NULL;
+}
+#endif
+
+void
+lr_trace_start(const char *content_path_)
+{
+  int rv;
+  const char *system_path;
+  char name[PATH_MAX_LENGTH];
+  char path[PATH_MAX_LENGTH];
+  static const char header[] =
+    "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+    "\"args\":{\"name\":\"opera\"}}";
+
+  system_path = NULL;
+  rv = retro_environment_cb(RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY,&system_path);
+  if((rv == 0) || (system_path == NULL))
+    return;
+
+  if(content_path_ != NULL)
+    fill_pathname_base_noext(name,content_path_,sizeof(name));
+  else
+    strlcpy(name,"bios",sizeof(name));
+  strlcat(name,".json",sizeof(name));
+
+  fill_pathname_join(path,system_path,"opera",sizeof(path));
+  fill_pathname_join(path,path,"trace",sizeof(path));
+  path_mkdir(path);
+  fill_pathname_join(path,path,name,sizeof(path));
+
+  g_OUT.len  = 0;
+  g_OUT.file = filestream_open(path,
+                               RETRO_VFS_FILE_ACCESS_WRITE,
+                               RETRO_VFS_FILE_ACCESS_HINT_NONE);
+  if(g_OUT.file == NULL)
+    {
+      retro_log_printf_cb(RETRO_LOG_ERROR,"[Opera]: unable to open trace %s\n",path);
+      return;
+    }
+
+  trace_out_write(&g_OUT,header,sizeof(header) - 1);
+
+  opera_trace_set_clock(trace_clock);
+  if(opera_trace_enable() != 0)
+    {
+      filestream_close(g_OUT.file);
+      g_OUT.file = NULL;
+      return;
+    }
+
+  retro_log_printf_cb(RETRO_LOG_INFO,"[Opera]: tracing to %s\n",path);
+
+#if THREADED_TRACE
+  g_quit = FALSE;
+  g_thread_running = !pthread_create(&g_thread,NULL,trace_thread_loop,NULL);
+#endif
+}
+
+void
+lr_trace_flush(void)
+{
+  if(g_OUT.file == NULL)
+    return;
+
+#if THREADED_TRACE
+  if(g_thread_running)
+    return;
+#endif
+
+  trace_drain();
+}
+
+void
+lr_trace_stop(void)
+{
+  static const char footer[] = "\n]\n";
+
+  if(g_OUT.file == NULL)
+    return;
+
+#if THREADED_TRACE
+  if(g_thread_running)
+    {
+      g_quit = TRUE;
+      pthread_join(g_thread,NULL);
+      g_thread_running = FALSE;
+    }
+#endif
+
+  opera_trace_disable();
+  trace_drain();
+
+  trace_out_write(&g_OUT,footer,sizeof(footer) - 1);
+  trace_out_flush(&g_OUT);
+
+  filestream_close(g_OUT.file);
+  g_OUT.file = NULL;
+}
+
+#endif
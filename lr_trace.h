@@ -0,0 +1,20 @@
+#ifndef LIBRETRO_LR_TRACE_H_INCLUDED
+#define LIBRETRO_LR_TRACE_H_INCLUDED
+
+#include "libopera/inline.h"
+
+#ifdef OPERA_TRACE
+
+void lr_trace_start(const char *content_path_);
+void lr_trace_flush(void);
+void lr_trace_stop(void);
+
+#else
+
+static INLINE void lr_trace_start(const char *content_path_) {}
+static INLINE void lr_trace_flush(void) {}
+static INLINE void lr_trace_stop(void) {}
+
+#endif
+
+#endif
@@ -17,8 +17,9 @@ cdimage_set_size_and_offset(cdimage_t *cd_,
                             const int  size_,
                             const int  offset_)
 {
-  cd_->sector_size   = size_;
-  cd_->sector_offset = offset_;
+  cd_->sector_size    = size_;
+  cd_->sector_offset  = offset_;
+  cd_->logical_blocks = -1;
 }
 
 int
@@ -160,9 +161,10 @@ retro_cdimage_close(cdimage_t *cdimage_)
   if(cdimage_->fp)
     rv = intfstream_close(cdimage_->fp);
 
-  cdimage_->fp            = NULL;
-  cdimage_->sector_size   = 0;
-  cdimage_->sector_offset = 0;
+  cdimage_->fp             = NULL;
+  cdimage_->sector_size    = 0;
+  cdimage_->sector_offset  = 0;
+  cdimage_->logical_blocks = -1;
 
   return rv;
 }
@@ -193,6 +195,9 @@ retro_cdimage_get_number_of_logical_blocks(cdimage_t *cdimage_)
   size_t pos;
   uint32_t blocks;
 
+  if(cdimage_->logical_blocks >= 0)
+    return cdimage_->logical_blocks;
+
   pos = (cdimage_->sector_offset + 80);
   rv = intfstream_seek(cdimage_->fp,pos,RETRO_VFS_SEEK_POSITION_START);
   if(rv == -1)
@@ -202,5 +207,7 @@ retro_cdimage_get_number_of_logical_blocks(cdimage_t *cdimage_)
   if(rv == -1)
     return -1;
 
-  return swap_if_little32(blocks);
+  cdimage_->logical_blocks = swap_if_little32(blocks);
+
+  return cdimage_->logical_blocks;
 }
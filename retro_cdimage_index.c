@@ -0,0 +1,327 @@
+#include "retro_cdimage_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <compat/strl.h>
+#include <file/file_path.h>
+#include <retro_miscellaneous.h>
+#include <streams/chd_stream.h>
+#include <streams/file_stream.h>
+#include <streams/interface_stream.h>
+
+#include <libretro.h>
+
+#define CDIMAGE_INDEX_MAGIC        0x4F504958 /* OPIX */
+#define CDIMAGE_INDEX_VERSION      3
+#define CDIMAGE_INDEX_HASH_BYTES   4096
+#define CDIMAGE_INDEX_FNV64_OFFSET 0xCBF29CE484222325ULL
+#define CDIMAGE_INDEX_FNV64_PRIME  0x00000100000001B3ULL
+
+enum cdimage_index_type_e
+  {
+    CDIMAGE_INDEX_TYPE_FILE = 0,
+    CDIMAGE_INDEX_TYPE_CHD  = 1
+  };
+
+struct cdimage_index_s
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t hash;
+  int64_t  size;
+  uint64_t image_hash;
+  int64_t  image_size;
+  int32_t  type;
+  int32_t  sector_size;
+  int32_t  sector_offset;
+  int32_t  logical_blocks;
+  char     image_path[PATH_MAX_LENGTH];
+};
+
+typedef struct cdimage_index_s cdimage_index_t;
+
+static
+uint64_t
+fnv64(uint64_t    hash_,
+      const void *buf_,
+      size_t      len_)
+{
+  const uint8_t *p = (const uint8_t*)buf_;
+
+  while(len_--)
+    {
+      hash_ ^= *p++;
+      hash_ *= CDIMAGE_INDEX_FNV64_PRIME;
+    }
+
+  return hash_;
+}
+
+/* folds the file's size and first few KiB into hash_ */
+static
+int
+cdimage_index_hash_file(const char *path_,
+                        uint64_t   *hash_,
+                        int64_t    *size_)
+{
+  RFILE *f;
+  int64_t rv;
+  uint8_t buf[CDIMAGE_INDEX_HASH_BYTES];
+
+  f = filestream_open(path_,
+                      RETRO_VFS_FILE_ACCESS_READ,
+                      RETRO_VFS_FILE_ACCESS_HINT_NONE);
+  if(f == NULL)
+    return -1;
+
+  *size_ = filestream_get_size(f);
+  rv     = filestream_read(f,buf,sizeof(buf));
+
+  filestream_close(f);
+
+  if(rv < 0)
+    return -1;
+
+  *hash_ = fnv64(*hash_,size_,sizeof(*size_));
+  *hash_ = fnv64(*hash_,buf,rv);
+
+  return 0;
+}
+
+/*
+  The fingerprint covers the file size and the first few KiB of the
+  file as stored on disk. For CHDs that is the header which includes
+  the SHA1 of the content and for raw images the system area and
+  volume label. A cue sheet says nothing about the data it points at
+  so the index also carries the fingerprint of the image it names,
+  see cdimage_index_image_matches().
+*/
+static
+int
+cdimage_index_fingerprint(const char *path_,
+                          uint64_t   *hash_,
+                          int64_t    *size_)
+{
+  *hash_ = CDIMAGE_INDEX_FNV64_OFFSET;
+
+  return cdimage_index_hash_file(path_,hash_,size_);
+}
+
+/* the image a cue sheet names is only known once the index is loaded */
+static
+int
+cdimage_index_image_matches(const char            *path_,
+                            const cdimage_index_t *idx_)
+{
+  int rv;
+  int64_t size;
+  uint64_t hash;
+
+  if(!strcmp(idx_->image_path,path_))
+    return 1;
+
+  rv = cdimage_index_fingerprint(idx_->image_path,&hash,&size);
+  if(rv == -1)
+    return 0;
+
+  return ((hash == idx_->image_hash) && (size == idx_->image_size));
+}
+
+static
+void
+cdimage_index_filepath(const char *path_,
+                       const char *cache_dir_,
+                       char       *idxpath_,
+                       size_t      idxpath_size_)
+{
+  uint64_t hash;
+  char filename[32];
+
+  hash = fnv64(CDIMAGE_INDEX_FNV64_OFFSET,path_,strlen(path_));
+  snprintf(filename,sizeof(filename),"%08X%08X.idx",
+           (uint32_t)(hash >> 32),
+           (uint32_t)(hash & 0xFFFFFFFF));
+
+  fill_pathname_join(idxpath_,cache_dir_,filename,idxpath_size_);
+}
+
+static
+int
+cdimage_index_load(const char      *idxpath_,
+                   cdimage_index_t *idx_)
+{
+  RFILE *f;
+  int64_t rv;
+
+  f = filestream_open(idxpath_,
+                      RETRO_VFS_FILE_ACCESS_READ,
+                      RETRO_VFS_FILE_ACCESS_HINT_NONE);
+  if(f == NULL)
+    return -1;
+
+  rv = filestream_read(f,idx_,sizeof(*idx_));
+
+  filestream_close(f);
+
+  if(rv != sizeof(*idx_))
+    return -1;
+  if(idx_->magic != CDIMAGE_INDEX_MAGIC)
+    return -1;
+  if(idx_->version != CDIMAGE_INDEX_VERSION)
+    return -1;
+
+  idx_->image_path[sizeof(idx_->image_path) - 1] = '\0';
+
+  return 0;
+}
+
+static
+int
+cdimage_index_save(const char            *idxpath_,
+                   const char            *cache_dir_,
+                   const cdimage_index_t *idx_)
+{
+  if(!path_is_directory(cache_dir_))
+    path_mkdir(cache_dir_);
+
+  return (filestream_write_file(idxpath_,idx_,sizeof(*idx_)) ? 0 : -1);
+}
+
+static
+int
+cdimage_index_open_stream(const cdimage_index_t *idx_,
+                          cdimage_t             *cdimage_)
+{
+  switch(idx_->type)
+    {
+    case CDIMAGE_INDEX_TYPE_CHD:
+      cdimage_->fp = intfstream_open_chd_track(idx_->image_path,
+                                               RETRO_VFS_FILE_ACCESS_READ,
+                                               RETRO_VFS_FILE_ACCESS_HINT_NONE,
+                                               CHDSTREAM_TRACK_PRIMARY);
+      break;
+    case CDIMAGE_INDEX_TYPE_FILE:
+      cdimage_->fp = intfstream_open_file(idx_->image_path,
+                                          RETRO_VFS_FILE_ACCESS_READ,
+                                          RETRO_VFS_FILE_ACCESS_HINT_NONE);
+      break;
+    default:
+      return -1;
+    }
+
+  if(cdimage_->fp == NULL)
+    return -1;
+
+  cdimage_->sector_size    = idx_->sector_size;
+  cdimage_->sector_offset  = idx_->sector_offset;
+  cdimage_->logical_blocks = idx_->logical_blocks;
+
+  return 0;
+}
+
+static
+int
+cdimage_index_build(const char      *path_,
+                    const cdimage_t *cdimage_,
+                    cdimage_index_t *idx_)
+{
+  const char *ext;
+  cueFile *cue_file;
+
+  ext = path_get_extension(path_);
+  if(!strcasecmp(ext,"chd"))
+    {
+      idx_->type = CDIMAGE_INDEX_TYPE_CHD;
+      strlcpy(idx_->image_path,path_,sizeof(idx_->image_path));
+    }
+  else if(!strcasecmp(ext,"cue"))
+    {
+      cue_file = cue_get(path_);
+      if(cue_file == NULL)
+        return -1;
+
+      idx_->type = CDIMAGE_INDEX_TYPE_FILE;
+      if(cue_file->cd_image != NULL)
+        strlcpy(idx_->image_path,cue_file->cd_image,sizeof(idx_->image_path));
+
+      free(cue_file->cd_image);
+      free(cue_file);
+
+      if(idx_->image_path[0] == '\0')
+        return -1;
+    }
+  else
+    {
+      idx_->type = CDIMAGE_INDEX_TYPE_FILE;
+      strlcpy(idx_->image_path,path_,sizeof(idx_->image_path));
+    }
+
+  if(strcmp(idx_->image_path,path_))
+    {
+      if(cdimage_index_fingerprint(idx_->image_path,
+                                   &idx_->image_hash,
+                                   &idx_->image_size) == -1)
+        return -1;
+    }
+
+  idx_->magic          = CDIMAGE_INDEX_MAGIC;
+  idx_->version        = CDIMAGE_INDEX_VERSION;
+  idx_->sector_size    = cdimage_->sector_size;
+  idx_->sector_offset  = cdimage_->sector_offset;
+  idx_->logical_blocks = cdimage_->logical_blocks;
+
+  return 0;
+}
+
+int
+retro_cdimage_open_indexed(const char *path_,
+                           const char *cache_dir_,
+                           cdimage_t  *cdimage_)
+{
+  int rv;
+  int64_t size;
+  uint64_t hash;
+  cdimage_index_t idx;
+  char idxpath[PATH_MAX_LENGTH];
+
+  if((cache_dir_ == NULL) || (path_get_extension(path_) == NULL))
+    return retro_cdimage_open(path_,cdimage_);
+
+  rv = cdimage_index_fingerprint(path_,&hash,&size);
+  if(rv == -1)
+    return retro_cdimage_open(path_,cdimage_);
+
+  memset(&idx,0,sizeof(idx));
+  cdimage_index_filepath(path_,cache_dir_,idxpath,sizeof(idxpath));
+
+  rv = cdimage_index_load(idxpath,&idx);
+  if((rv == 0) &&
+     (idx.hash == hash) &&
+     (idx.size == size) &&
+     cdimage_index_image_matches(path_,&idx))
+    {
+      rv = cdimage_index_open_stream(&idx,cdimage_);
+      if(rv == 0)
+        return 0;
+    }
+
+  rv = retro_cdimage_open(path_,cdimage_);
+  if(rv == -1)
+    return -1;
+
+  if(retro_cdimage_get_number_of_logical_blocks(cdimage_) < 0)
+    return 0;
+
+  memset(&idx,0,sizeof(idx));
+  rv = cdimage_index_build(path_,cdimage_,&idx);
+  if(rv == -1)
+    return 0;
+
+  idx.hash = hash;
+  idx.size = size;
+  cdimage_index_save(idxpath,cache_dir_,&idx);
+
+  return 0;
+}
@@ -0,0 +1,19 @@
+#ifndef LIBRETRO_RETRO_CDIMAGE_INDEX_H_INCLUDED
+#define LIBRETRO_RETRO_CDIMAGE_INDEX_H_INCLUDED
+
+#include "retro_cdimage.h"
+
+/*
+  Opens a disc image using a small sidecar index stored in
+  `cache_dir_`. The index records everything normally probed at load
+  time (underlying image path, sector layout and volume size, from
+  which the TOC is derived) along with a fingerprint of the image. On
+  a miss or stale fingerprint the image is opened normally and the
+  index is rewritten.
+*/
+int
+retro_cdimage_open_indexed(const char *path_,
+                           const char *cache_dir_,
+                           cdimage_t  *cdimage_);
+
+#endif
@@ -0,0 +1,659 @@
+/*
+  opera-gentables: emits libopera's constant lookup tables
+
+  The DSP instruction decode tables and the MADAM pixel decode tables
+  only depend on bit layouts so they are computed here once and
+  written out as static const arrays rather than being rebuilt by
+  every instance at init. The bitfield types below mirror the ones in
+  opera_dsp.c and opera_madam.c and must be kept in step with them.
+  The CLIO handler index is expanded from the register description
+  in opera_clio_regs_i.h.
+
+  usage: opera-gentables <dsp|madam|clio>
+
+  The table header is written to stdout. The decoders index these
+  tables through little endian bitfield layouts so they can only be
+  generated on a little endian host. Big endian builds of libopera
+  build the DSP and MADAM tables at init and never include them.
+*/
+
+#include "../libopera/opera_clio_regs_i.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define CLIO_IO_WORDS 0x4000
+
+#pragma pack(push,1)
+
+struct AIFTAG_s
+{
+  uint32_t BS:4;
+  uint32_t ALU:4;
+  uint32_t MUXB:2;
+  uint32_t MUXA:2;
+  int32_t  M2SEL:1;
+  uint32_t NUMOPS:2;
+  int32_t  PAD:1;
+};
+
+typedef struct AIFTAG_s AIFTAG_t;
+
+struct BRNTAG_s
+{
+  uint32_t BCH_ADDR:10;
+  uint32_t FLAGM0:1;
+  uint32_t FLAGM1:1;
+  uint32_t FLAGSEL:1;
+  uint32_t MODE0:1;
+  uint32_t MODE1:1;
+  uint32_t AC:1;
+};
+
+typedef struct BRNTAG_s BRNTAG_t;
+
+struct BRNBITS_s
+{
+  uint32_t BCH_ADDR:10;
+  uint32_t bits:5;
+  uint32_t AC:1;
+};
+
+typedef struct BRNBITS_s BRNBITS_t;
+
+union ITAG_u
+{
+  uint32_t  raw;
+  AIFTAG_t  aif;
+  BRNTAG_t  branch;
+  BRNBITS_t br;
+};
+
+typedef union ITAG_u ITAG_t;
+
+struct RQFTAG_s
+{
+  uint32_t BS:1;
+  uint32_t ALU2:1;
+  uint32_t ALU1:1;
+  uint32_t MULT2:1;
+  uint32_t MULT1:1;
+};
+
+typedef struct RQFTAG_s RQFTAG_t;
+
+union REQ_u
+{
+  uint8_t  raw;
+  RQFTAG_t rq;
+};
+
+typedef union REQ_u REQ_t;
+
+union dsp_alu_flags_u
+{
+  uint32_t raw;
+
+  struct
+  {
+    uint8_t zero;
+    uint8_t negative;
+    uint8_t carry;
+    uint8_t overflow;
+  };
+};
+
+typedef union dsp_alu_flags_u dsp_alu_flags_t;
+
+struct cp8btag_s
+{
+  uint16_t c:5;
+  uint16_t mpw:1;
+  uint16_t m:2;
+  uint16_t pad:8;
+};
+
+typedef struct cp8btag_s cp8btag_t;
+
+struct cp16btag_s
+{
+  uint16_t c:5;
+  uint16_t mb:3;
+  uint16_t mg:3;
+  uint16_t mr:3;
+  uint16_t pad:1;
+  uint16_t pw:1;
+};
+
+typedef struct cp16btag_s cp16btag_t;
+
+struct up8btag_s
+{
+  uint16_t b:2;
+  uint16_t g:3;
+  uint16_t r:3;
+  uint16_t pad:8;
+};
+
+typedef struct up8btag_s up8btag_t;
+
+struct res16btag_s
+{
+  uint16_t b:5;
+  uint16_t g:5;
+  uint16_t r:5;
+  uint16_t p:1;
+};
+
+typedef struct res16btag_s res16btag_t;
+
+union pdeco_u
+{
+  uint32_t    raw;
+  cp8btag_t   c8b;
+  cp16btag_t  c16b;
+  up8btag_t   u8b;
+  res16btag_t r16b;
+};
+
+typedef union pdeco_u pdeco_t;
+
+#pragma pack(pop)
+
+static uint8_t  INSTTRAS_REQ[0x8000];
+static uint8_t  INSTTRAS_BS[0x8000];
+static uint16_t REGCONV[8][16];
+static uint8_t  BRCONDTAB[32][32];
+
+static uint8_t  PSCALAR[8][4][32];
+static uint16_t MAPu8b[256+64];
+static uint16_t MAPc8bAMV[256+64];
+static uint16_t MAPc16bAMV[8*8*8+64];
+
+static
+uint16_t
+dsp_register_base(uint32_t reg_,
+                  uint32_t rmap_)
+{
+  uint8_t x;
+  uint8_t y;
+  uint8_t twi;
+
+  reg_ &= 0x0000000F;
+  x     = ((reg_ >> 2) & 1);
+  y     = ((reg_ >> 3) & 1);
+
+  switch(rmap_)
+    {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      twi = x;
+      break;
+    case 4:
+      twi = y;
+      break;
+    case 5:
+      twi = !y;
+      break;
+    case 6:
+      twi = x & y;
+      break;
+    case 7:
+      twi = x | y;
+      break;
+    }
+
+  return ((reg_ & 7) | (twi << 8) | (reg_ >> 3) << 9);
+}
+
+static
+void
+dsp_tables_build(void)
+{
+  int32_t a,c;
+  ITAG_t inst;
+  REQ_t req;
+
+  for(a = 0; a < 16; a++)
+    for(c = 0; c < 8; c++)
+      REGCONV[c][a] = dsp_register_base(a,c);
+
+  for(inst.raw = 0; inst.raw < 0x8000; inst.raw++)
+    {
+      req.raw = 0;
+
+      if(inst.aif.BS == 0x8)
+        req.rq.BS = 1;
+
+      switch(inst.aif.MUXA)
+        {
+        case 3:
+          req.rq.MULT1 = 1;
+          req.rq.MULT2 = inst.aif.M2SEL;
+          break;
+        case 1:
+          req.rq.ALU1 = 1;
+          break;
+        case 2:
+          req.rq.ALU2 = 1;
+          break;
+        }
+
+      switch(inst.aif.MUXB)
+        {
+        case 1:
+          req.rq.ALU1 = 1;
+          break;
+        case 2:
+          req.rq.ALU2 = 1;
+          break;
+        case 3:
+          req.rq.MULT1 = 1;
+          req.rq.MULT2 = inst.aif.M2SEL;
+          break;
+        }
+
+      INSTTRAS_REQ[inst.raw] = req.raw;
+      INSTTRAS_BS[inst.raw]  = (inst.aif.BS | ((inst.aif.ALU & 8) << (4 - 3)));
+    }
+
+  {
+    int MD1, MD2, MD3;
+    int STAT0, STAT1;
+    int NSTAT0, NSTAT1;
+    int TDCARE0, TDCARE1;
+    int RDCARE;
+    int MD12S;
+    int SUPER0, SUPER1;
+    int ALLZERO, NALLZERO;
+    int SDS;
+    int NVTest;
+    int TMPCS;
+    int CZTest, XactTest;
+    int MD3S;
+    int fExact;
+
+    dsp_alu_flags_t flags;
+
+    flags.raw = 0;
+    for(inst.raw = 0xA000; inst.raw <= 0xFFFF; inst.raw += 1024)
+      for(flags.zero = 0; flags.zero < 2; flags.zero++)
+        for(flags.negative = 0; flags.negative < 2; flags.negative++)
+          for(flags.carry = 0; flags.carry < 2; flags.carry++)
+            for(flags.overflow = 0; flags.overflow < 2; flags.overflow++)
+              for(fExact = 0; fExact < 2; fExact++)
+                {
+                  MD1 = !inst.branch.MODE1 && inst.branch.MODE0;
+                  MD2 = inst.branch.MODE1 && !inst.branch.MODE0;
+                  MD3 = inst.branch.MODE1 && inst.branch.MODE0;
+
+                  STAT0  = (inst.branch.FLAGSEL && flags.carry) || (!inst.branch.FLAGSEL && flags.negative);
+                  STAT1  = (inst.branch.FLAGSEL && flags.zero) || (!inst.branch.FLAGSEL && flags.overflow);
+                  NSTAT0 = STAT0 != MD2;
+                  NSTAT1 = STAT1 != MD2;
+
+                  TDCARE1 = !inst.branch.FLAGM1 || (inst.branch.FLAGM1 && NSTAT0);
+                  TDCARE0 = !inst.branch.FLAGM0 || (inst.branch.FLAGM0 && NSTAT1);
+
+                  RDCARE = !inst.branch.FLAGM1 && !inst.branch.FLAGM0;
+
+                  MD12S = TDCARE1 && TDCARE0 && (inst.branch.MODE1!=inst.branch.MODE0) && !RDCARE;
+
+                  SUPER0 = MD1 && !inst.branch.FLAGSEL && RDCARE;
+                  SUPER1 = MD1 && inst.branch.FLAGSEL &&  RDCARE;
+
+                  ALLZERO  = SUPER0 && flags.zero && fExact;
+                  NALLZERO = SUPER1 && !(flags.zero && fExact);
+
+                  SDS = ALLZERO || NALLZERO;
+
+                  NVTest   = ((((flags.negative != flags.overflow) ||
+                                (flags.zero && inst.branch.FLAGM0)) != inst.branch.FLAGM1) &&
+                              !inst.branch.FLAGSEL);
+                  TMPCS    = flags.carry && !flags.zero;
+                  CZTest   = (TMPCS != inst.branch.FLAGM0) && inst.branch.FLAGSEL && !inst.branch.FLAGM1;
+                  XactTest = (fExact != inst.branch.FLAGM0) && inst.branch.FLAGSEL && inst.branch.FLAGM1;
+
+                  MD3S = ((NVTest || CZTest || XactTest) && MD3);
+
+                  BRCONDTAB[inst.br.bits][fExact+((flags.raw*0x10080402)>>24)] = (MD12S || MD3S || SDS);
+                }
+  }
+}
+
+static
+int32_t
+PDV(const int32_t x_)
+{
+  return (((x_ - 1) & 3) + 1);
+}
+
+static
+void
+madam_tables_build(void)
+{
+  int32_t i;
+  int32_t j;
+  int32_t n;
+
+  for(i = 0; i < 32; i++)
+    for(j = 0; j < 8; j++)
+      for(n = 0; n < 4; n++)
+        PSCALAR[j][n][i] = ((i * (j + 1)) >> PDV(n));
+
+  for(i = 0; i < 256; i++)
+    {
+      pdeco_t  pix1;
+      pdeco_t  pix2;
+      uint16_t pres;
+      uint16_t resamv;
+
+      pix1.raw     = i;
+      pix2.raw     = 0;
+      pix2.r16b.b  = (pix1.u8b.b << 3) + (pix1.u8b.b << 1) + (pix1.u8b.b >> 1);
+      pix2.r16b.g  = (pix1.u8b.g << 2) + (pix1.u8b.g >> 1);
+      pix2.r16b.r  = (pix1.u8b.r << 2) + (pix1.u8b.r >> 1);
+      pres         = pix2.raw;
+      pres        &= 0x7fff;
+      MAPu8b[i]    = pres;
+
+      resamv       = ((pix1.c8b.m << 1) + pix1.c8b.mpw);
+      resamv       = ((resamv << 6) + (resamv << 3) + resamv);
+      MAPc8bAMV[i] = resamv;
+    }
+
+  for(i = 0; i < (8*8*8); i++)
+    {
+      pdeco_t pix1;
+
+      pix1.raw = i << 5;
+      MAPc16bAMV[i] = ((pix1.c16b.mr << 6) + (pix1.c16b.mg << 3) + pix1.c16b.mb);
+    }
+}
+
+static
+void
+emit_values(const char     *fmt_,
+            const uint32_t *values_,
+            const uint32_t  count_,
+            const uint32_t  per_line_,
+            const char     *indent_)
+{
+  uint32_t i;
+
+  for(i = 0; i < count_; i++)
+    {
+      if((i % per_line_) == 0)
+        printf("%s",indent_);
+      printf(fmt_,values_[i]);
+      if(i != (count_ - 1))
+        printf(",");
+      if(((i % per_line_) == (per_line_ - 1)) || (i == (count_ - 1)))
+        printf("\n");
+    }
+}
+
+static
+void
+emit_u8(const char    *decl_,
+        const uint8_t *table_,
+        const uint32_t count_,
+        const uint32_t row_)
+{
+  uint32_t i;
+  uint32_t values[256];
+
+  printf("%s =\n  {\n",decl_);
+  for(i = 0; i < count_; i += row_)
+    {
+      uint32_t j;
+
+      for(j = 0; j < row_; j++)
+        values[j] = table_[i + j];
+      printf("    {\n");
+      emit_values("%u",values,row_,16,"      ");
+      printf("    }%s\n",(((i + row_) < count_) ? "," : ""));
+    }
+  printf("  };\n\n");
+}
+
+static
+void
+emit_u16(const char     *decl_,
+         const uint16_t *table_,
+         const uint32_t  count_)
+{
+  uint32_t i;
+  uint32_t values[8*8*8+64];
+
+  for(i = 0; i < count_; i++)
+    values[i] = table_[i];
+
+  printf("%s =\n  {\n",decl_);
+  emit_values("0x%04X",values,count_,8,"    ");
+  printf("  };\n\n");
+}
+
+static
+void
+emit_header(const char *guard_,
+            const char *what_)
+{
+  printf("/* generated by tools/opera-gentables %s, do not edit */\n\n",what_);
+  printf("#ifndef %s\n",guard_);
+  printf("#define %s\n\n",guard_);
+}
+
+static
+void
+emit_little_endian_only(void)
+{
+  printf("#if IS_BIG_ENDIAN\n");
+  printf("#error \"little endian bitfield layouts, build the tables at init\"\n");
+  printf("#endif\n\n");
+}
+
+static
+void
+emit_footer(const char *guard_)
+{
+  printf("#endif /* %s */\n",guard_);
+}
+
+static
+void
+emit_dsp(void)
+{
+  uint32_t i;
+  uint32_t values[0x8000];
+
+  dsp_tables_build();
+
+  emit_header("LIBOPERA_DSP_TABLES_I_H_INCLUDED","dsp");
+  emit_little_endian_only();
+
+  printf("/* ALU operand requests and barrel shift per instruction word */\n");
+  printf("static const INSTTRAS_t INSTTRAS[0x8000] =\n  {\n");
+  for(i = 0; i < 0x8000; i++)
+    values[i] = ((INSTTRAS_REQ[i] << 8) | INSTTRAS_BS[i]);
+  for(i = 0; i < 0x8000; i++)
+    {
+      if((i % 16) == 0)
+        printf("    ");
+      printf("{{%u},%u}",(values[i] >> 8),(values[i] & 0xFF));
+      if(i != (0x8000 - 1))
+        printf(",");
+      if(((i % 16) == 15) || (i == (0x8000 - 1)))
+        printf("\n");
+    }
+  printf("  };\n\n");
+
+  printf("/* register file address per RMAP and register select */\n");
+  printf("static const uint16_t REGCONV[8][16] =\n  {\n");
+  for(i = 0; i < 8; i++)
+    {
+      uint32_t j;
+
+      for(j = 0; j < 16; j++)
+        values[j] = REGCONV[i][j];
+      printf("    {\n");
+      emit_values("0x%04X",values,16,8,"      ");
+      printf("    }%s\n",((i < 7) ? "," : ""));
+    }
+  printf("  };\n\n");
+
+  printf("/* branch taken per condition bits and ALU flags */\n");
+  emit_u8("static const uint8_t BRCONDTAB[32][32]",&BRCONDTAB[0][0],32*32,32);
+
+  emit_footer("LIBOPERA_DSP_TABLES_I_H_INCLUDED");
+}
+
+static
+void
+emit_madam(void)
+{
+  uint32_t i;
+  uint32_t j;
+
+  madam_tables_build();
+
+  emit_header("LIBOPERA_MADAM_TABLES_I_H_INCLUDED","madam");
+  emit_little_endian_only();
+
+  printf("/* (i * (multiplier + 1)) >> divider */\n");
+  printf("static const uint8_t PSCALAR[8][4][32] =\n  {\n");
+  for(i = 0; i < 8; i++)
+    {
+      printf("    {\n");
+      for(j = 0; j < 4; j++)
+        {
+          uint32_t k;
+          uint32_t values[32];
+
+          for(k = 0; k < 32; k++)
+            values[k] = PSCALAR[i][j][k];
+          printf("      {\n");
+          emit_values("%u",values,32,16,"        ");
+          printf("      }%s\n",((j < 3) ? "," : ""));
+        }
+      printf("    }%s\n",((i < 7) ? "," : ""));
+    }
+  printf("  };\n\n");
+
+  printf("/* unpacked 8bpp to 555 */\n");
+  emit_u16("static const uint16_t MAPu8b[256+64]",MAPu8b,256+64);
+  printf("/* coded 8bpp to AMV */\n");
+  emit_u16("static const uint16_t MAPc8bAMV[256+64]",MAPc8bAMV,256+64);
+  printf("/* coded 16bpp to AMV */\n");
+  emit_u16("static const uint16_t MAPc16bAMV[8*8*8+64]",MAPc16bAMV,8*8*8+64);
+
+  emit_footer("LIBOPERA_MADAM_TABLES_I_H_INCLUDED");
+}
+
+struct clio_range_s
+{
+  uint32_t first;
+  uint32_t last;
+};
+
+typedef struct clio_range_s clio_range_t;
+
+#define CLIO_RANGE(FIRST,LAST,PEEK,POKE) {FIRST,LAST},
+
+static const clio_range_t CLIO_RANGES[] =
+  {
+    CLIO_REGS(CLIO_RANGE)
+  };
+
+static
+int
+emit_clio(void)
+{
+  uint32_t i;
+  uint32_t addr;
+  uint32_t count;
+  uint32_t values[CLIO_IO_WORDS];
+
+  count = (sizeof(CLIO_RANGES) / sizeof(CLIO_RANGES[0]));
+  if(count > 0xFF)
+    {
+      fprintf(stderr,"opera-gentables: too many CLIO register entries\n");
+      return 1;
+    }
+
+  /* index 0 is the unmapped handler, entry i is handler i + 1 */
+  memset(values,0,sizeof(values));
+  for(i = 0; i < count; i++)
+    {
+      if((CLIO_RANGES[i].first & 3) ||
+         (CLIO_RANGES[i].last & 3) ||
+         (CLIO_RANGES[i].first > CLIO_RANGES[i].last) ||
+         ((CLIO_RANGES[i].last >> 2) >= CLIO_IO_WORDS))
+        {
+          fprintf(stderr,"opera-gentables: bad CLIO range 0x%04X..0x%04X\n",
+                  CLIO_RANGES[i].first,
+                  CLIO_RANGES[i].last);
+          return 1;
+        }
+
+      for(addr = CLIO_RANGES[i].first; addr <= CLIO_RANGES[i].last; addr += 4)
+        values[addr >> 2] = (i + 1);
+    }
+
+  emit_header("LIBOPERA_CLIO_TABLES_I_H_INCLUDED","clio");
+
+  printf("/* handler per register word, see opera_clio_regs_i.h */\n");
+  printf("static const uint8_t CLIO_IO[0x%X] =\n  {\n",CLIO_IO_WORDS);
+  emit_values("%u",values,CLIO_IO_WORDS,32,"    ");
+  printf("  };\n\n");
+
+  emit_footer("LIBOPERA_CLIO_TABLES_I_H_INCLUDED");
+
+  return 0;
+}
+
+static
+int
+host_is_little_endian(void)
+{
+  uint32_t v = 1;
+  uint8_t  b;
+
+  memcpy(&b,&v,1);
+
+  return (b == 1);
+}
+
+int
+main(int    argc_,
+     char **argv_)
+{
+  if(argc_ != 2)
+    {
+      fprintf(stderr,"usage: %s <dsp|madam|clio>\n",argv_[0]);
+      return 1;
+    }
+
+  if(!host_is_little_endian())
+    {
+      fprintf(stderr,"%s: tables must be generated on a little endian host\n",argv_[0]);
+      return 1;
+    }
+
+  if(!strcmp(argv_[1],"dsp"))
+    emit_dsp();
+  else if(!strcmp(argv_[1],"madam"))
+    emit_madam();
+  else if(!strcmp(argv_[1],"clio"))
+    return emit_clio();
+  else
+    {
+      fprintf(stderr,"%s: unknown table set '%s'\n",argv_[0],argv_[1]);
+      return 1;
+    }
+
+  return 0;
+}